@@ -0,0 +1,761 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include "./List/List.h"
+#include "./Vector/Vector.h"
+#include "./SortingAlgorithms/QuickSort/QuickSort.h"
+#include "./SortingAlgorithms/IntroSort/IntroSort.h"
+#include "./SortingAlgorithms/ShellSort/ShellSort.h"
+#include "./SortingAlgorithms/HeapSort/HeapSort.h"
+#include "./SortingAlgorithms/InsertionSort/InsertionSort.h"
+#include "./SortingAlgorithms/RadixSort/RadixSort.h"
+#include "./SortingAlgorithms/CountingSort/CountingSort.h"
+#include "./SortingAlgorithms/SortingKernels/SortingKernels.h"
+#include "./SortingAlgorithms/SortingNetwork/SortingNetwork.h"
+#include "./DataFile/TextFormat.h"
+#include "./DataFile/TextParser.h"
+#include "./ThreadPool/ThreadPool.h"
+#include <sys/resource.h>
+#include <vector>
+#include <utility>
+#include <random>
+
+// Milliseconds elapsed since 'start' with sub-millisecond precision
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename ListType>
+void measureList(const std::string& label, const std::string& inputFile, int size, int repeats) {
+    double loadMs = 0.0, generateMs = 0.0, clearMs = 0.0;
+
+    for (int r = 0; r < repeats; ++r) {
+        ListType list;
+
+        auto start = std::chrono::steady_clock::now();
+        list.loadFromFile(inputFile);
+        loadMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        list.clear();
+        clearMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        list.generateList(size);
+        generateMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        list.clear();
+        clearMs += elapsedMs(start);
+    }
+
+    std::cout << std::left << std::setw(12) << label << std::fixed << std::setprecision(3)
+              << " load: " << loadMs / repeats << " ms"
+              << "  generate: " << generateMs / repeats << " ms"
+              << "  clear: " << clearMs / (2.0 * repeats) << " ms\n";
+}
+
+// Compare the slab pool against plain new/delete per node
+void benchmarkListAllocator(int size, int repeats) {
+    const std::string inputFile = "bench_list_input.txt";
+
+    Vector<int> values;
+    values.generateRandom(size);
+    values.saveToFile(inputFile);
+
+    std::cout << "List<int> allocator, " << size << " elements, " << repeats << " repeats\n";
+    measureList<List<int, HeapNodeAllocator<int>>>("new/delete", inputFile, size, repeats);
+    measureList<List<int, NodePool<int>>>("NodePool", inputFile, size, repeats);
+
+    std::remove(inputFile.c_str());
+}
+
+// Peak resident set size of this process in kilobytes
+static long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Sort a List<int> through the List overload and report time and peak RSS
+void benchmarkListSort(int size) {
+    List<int> list;
+    list.generateList(size);
+    long rssBefore = peakRssKb();
+
+    QuickSort<int> sorter;
+    auto start = std::chrono::steady_clock::now();
+    sorter.sort(list, 'm');
+    double sortMs = elapsedMs(start);
+
+    std::cout << "List<int> quick sort, " << size << " elements\n"
+              << std::fixed << std::setprecision(3)
+              << "sort: " << sortMs << " ms\n"
+              << "peak RSS before sort: " << rssBefore << " KB\n"
+              << "peak RSS after sort:  " << peakRssKb() << " KB\n";
+    list.checkSortedList();
+}
+
+// Read every value after the header without trusting the count, so the
+// vector has to grow as it goes (the "unknown N" case)
+static double loadUnknownCount(const std::string& inputFile, Vector<int>& values) {
+    auto start = std::chrono::steady_clock::now();
+    FILE* file = fopen(inputFile.c_str(), "r");
+    if (file == nullptr) {
+        return 0.0;
+    }
+
+    int header, value;
+    if (fscanf(file, "%d", &header) == 1) {
+        while (fscanf(file, "%d", &value) == 1) {
+            values.pushBack(value);
+        }
+    }
+    fclose(file);
+    return elapsedMs(start);
+}
+
+// Growth-heavy Vector<T> workloads
+void benchmarkVectorGrowth(int size, int repeats) {
+    double noReserveMs = 0.0, reserveMs = 0.0, stdVectorMs = 0.0, stringMs = 0.0, moveMs = 0.0;
+
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        Vector<int> grown;
+        for (int i = 0; i < size; ++i) {
+            grown.pushBack(i);
+        }
+        noReserveMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        Vector<int> reserved(size);
+        for (int i = 0; i < size; ++i) {
+            reserved.pushBack(i);
+        }
+        reserveMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<int> reference;
+        for (int i = 0; i < size; ++i) {
+            reference.push_back(i);
+        }
+        stdVectorMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        Vector<std::string> strings;
+        for (int i = 0; i < size / 10; ++i) {
+            strings.emplaceBack(24, 'x');
+        }
+        stringMs += elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        Vector<int> moved(std::move(grown));
+        moveMs += elapsedMs(start);
+    }
+
+    const std::string inputFile = "bench_vector_input.txt";
+    Vector<int> source;
+    source.generateRandom(size);
+    source.saveToFile(inputFile);
+
+    Vector<int> known;
+    auto start = std::chrono::steady_clock::now();
+    known.loadFromFile(inputFile);
+    double knownMs = elapsedMs(start);
+
+    Vector<int> unknown;
+    double unknownMs = loadUnknownCount(inputFile, unknown);
+    std::remove(inputFile.c_str());
+
+    std::cout << "Vector growth, " << size << " elements, " << repeats << " repeats\n"
+              << std::fixed << std::setprecision(3)
+              << "pushBack, no reserve:       " << noReserveMs / repeats << " ms\n"
+              << "pushBack, reserved:         " << reserveMs / repeats << " ms\n"
+              << "std::vector, no reserve:    " << stdVectorMs / repeats << " ms\n"
+              << "emplaceBack std::string/10: " << stringMs / repeats << " ms\n"
+              << "move construction:          " << moveMs / repeats << " ms\n"
+              << "loadFromFile, known N:      " << knownMs << " ms\n"
+              << "load, unknown N:            " << unknownMs << " ms (" << unknown.getSize() << " values)\n";
+}
+
+template <typename Sorter>
+static double timeSort(const Vector<int>& input, char pivot, bool& sorted) {
+    Vector<int> values(input);
+    Sorter sorter;
+
+    auto start = std::chrono::steady_clock::now();
+    sorter.sort(values, pivot);
+    double ms = elapsedMs(start);
+
+    sorted = true;
+    for (int i = 1; i < values.getSize(); ++i) {
+        if (values[i - 1] > values[i]) {
+            sorted = false;
+            break;
+        }
+    }
+    return ms;
+}
+
+// QuickSort vs IntroSort on inputs that defeat naive pivots
+void benchmarkIntroSort(int size) {
+    Vector<int> inputs[4];
+    const char* names[4] = {"random", "ascending", "descending", "all equal"};
+
+    inputs[0].generateRandom(size);
+    inputs[1].generateAscending(size);
+    inputs[2].generateDescending(size);
+    for (int i = 0; i < size; ++i) {
+        inputs[3].pushBack(42);
+    }
+
+    std::cout << "QuickSort vs IntroSort, " << size << " elements (ms)\n"
+              << std::left << std::setw(12) << "input"
+              << std::setw(12) << "quick l" << std::setw(12) << "quick m"
+              << std::setw(12) << "intro l" << std::setw(12) << "intro 3" << std::setw(12) << "intro n" << "\n";
+
+    for (int k = 0; k < 4; ++k) {
+        bool ok[5];
+        double times[5] = {
+            timeSort<QuickSort<int>>(inputs[k], 'l', ok[0]),
+            timeSort<QuickSort<int>>(inputs[k], 'm', ok[1]),
+            timeSort<IntroSort<int>>(inputs[k], 'l', ok[2]),
+            timeSort<IntroSort<int>>(inputs[k], '3', ok[3]),
+            timeSort<IntroSort<int>>(inputs[k], 'n', ok[4]),
+        };
+
+        std::cout << std::setw(12) << names[k] << std::fixed << std::setprecision(3);
+        for (int j = 0; j < 5; ++j) {
+            std::cout << std::setw(12) << times[j];
+            if (!ok[j]) std::cout << "(unsorted!)";
+        }
+        std::cout << "\n";
+    }
+}
+
+template <typename T>
+static void benchmarkHeapsOfType(const char* typeName, int maxSize) {
+    const int variantCount = 6;
+    const char* names[variantCount] = {"classic", "iter", "bottomup", "4ary", "8ary", "4ary nopf"};
+    const HeapVariant variants[variantCount] = {HeapVariant::Classic, HeapVariant::Iterative, HeapVariant::BottomUp,
+                                                HeapVariant::FourAry, HeapVariant::EightAry, HeapVariant::FourAry};
+
+    std::cout << typeName << " (ms per sort)\n" << std::left << std::setw(10) << "size";
+    for (int j = 0; j < variantCount; ++j) {
+        std::cout << std::setw(11) << names[j];
+    }
+    std::cout << "best speedup\n";
+
+    for (int size = 1000; size <= maxSize; size *= 10) {
+        Vector<T> input;
+        input.generateRandom(size);
+        int repeats = size < 1000000 ? 1000000 / size : 1;
+
+        double times[variantCount];
+        bool sorted[variantCount];
+        for (int j = 0; j < variantCount; ++j) {
+            HeapSort<T> sorter;
+            sorter.setVariant(variants[j]);
+            sorter.setPrefetch(j != variantCount - 1);
+
+            double total = 0.0;
+            for (int r = 0; r < repeats; ++r) {
+                Vector<T> values(input);
+                auto start = std::chrono::steady_clock::now();
+                sorter.sort(values);
+                total += elapsedMs(start);
+
+                sorted[j] = true;
+                for (int i = 1; i < size && sorted[j]; ++i) {
+                    sorted[j] = !(values[i] < values[i - 1]);
+                }
+            }
+            times[j] = total / repeats;
+        }
+
+        double best = times[1];
+        for (int j = 2; j < variantCount; ++j) {
+            if (times[j] < best) best = times[j];
+        }
+
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(3);
+        for (int j = 0; j < variantCount; ++j) {
+            std::cout << std::setw(11) << times[j];
+            if (!sorted[j]) std::cout << "(unsorted!)";
+        }
+        std::cout << std::setprecision(2) << times[0] / best << "x\n";
+    }
+}
+
+// HeapSort variants on random input from 1000 elements up to maxSize; the
+// last column is classic time over the fastest variant's time
+void benchmarkHeaps(int maxSize) {
+    std::cout << "HeapSort variants, random input\n";
+    benchmarkHeapsOfType<int>("int", maxSize);
+    benchmarkHeapsOfType<double>("double", maxSize);
+}
+
+template <typename T, typename SortCall>
+static void timeTypeRun(const Vector<T>& input, const char* label, SortCall sortCall) {
+    Vector<T> values(input);
+
+    auto start = std::chrono::steady_clock::now();
+    sortCall(values);
+    double ms = elapsedMs(start);
+
+    bool sorted = true;
+    for (int i = 1; i < values.getSize() && sorted; ++i) {
+        sorted = !(values[i] < values[i - 1]);
+    }
+    std::cout << "  " << std::left << std::setw(12) << label << std::fixed << std::setprecision(3)
+              << ms << " ms" << (sorted ? "" : " (unsorted!)") << "\n";
+}
+
+template <typename T>
+static void benchmarkType(const char* typeName, int size) {
+    Vector<T> input;
+    input.generateRandom(size);
+
+    std::cout << typeName << ":\n";
+    timeTypeRun(input, "shell", [](Vector<T>& v) { ShellSort<T> s; s.sort(v, GapSequences::Tokuda); });
+    timeTypeRun(input, "quick", [](Vector<T>& v) { QuickSort<T> s; s.sort(v, 'm'); });
+    timeTypeRun(input, "quick-3way", [](Vector<T>& v) { QuickSort<T> s; s.sort3Way(v, 'm'); });
+    timeTypeRun(input, "intro", [](Vector<T>& v) { IntroSort<T> s; s.sort(v); });
+    timeTypeRun(input, "radix", [](Vector<T>& v) { RadixSort<T> s; s.sort(v); });
+    if constexpr (UsesCountingSort<T>::value) {
+        timeTypeRun(input, "counting", [](Vector<T>& v) { CountingSort<T> s; s.sort(v); });
+    }
+}
+
+// The test-3 "types" scenario: random input of every data type
+void benchmarkTypes(int size) {
+    std::cout << "Types scenario, random input, " << size << " elements\n";
+    benchmarkType<int>("int", size);
+    benchmarkType<float>("float", size);
+    benchmarkType<double>("double", size);
+    benchmarkType<char>("char", size);
+}
+
+template <typename T>
+static void insertionSortBlock(T* data, int n) {
+    for (int i = 1; i < n; ++i) {
+        T key = data[i];
+        int j = i - 1;
+        while (j >= 0 && data[j] > key) {
+            data[j + 1] = data[j];
+            j--;
+        }
+        data[j + 1] = key;
+    }
+}
+
+// Nanoseconds per block for sorting 'blocks' consecutive blocks of n values
+template <typename T, typename SortBlock>
+static double timeBlocks(const Vector<T>& input, int n, int blocks, SortBlock sortBlock) {
+    Vector<T> values(input);
+    T* data = values.getData();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocks; ++b) {
+        sortBlock(data + static_cast<long long>(b) * n, n);
+    }
+    return elapsedMs(start) * 1e6 / blocks;
+}
+
+template <typename T>
+static void benchmarkInsertionOfType(const char* typeName, int maxSize) {
+    const InsertionVariant variants[3] = {InsertionVariant::Linear, InsertionVariant::Sentinel, InsertionVariant::Binary};
+    const int blocks = 100000;
+
+    // Hybrid finisher sizes: ns per block over many consecutive blocks
+    for (int n : {8, 16, 32}) {
+        Vector<T> input;
+        input.generateRandom(n * blocks);
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(10) << n << std::setw(6) << "ns"
+                  << std::fixed << std::setprecision(1);
+        for (InsertionVariant variant : variants) {
+            std::cout << std::setw(12) << timeBlocks(input, n, blocks, [variant](T* d, int k) {
+                InsertionSort<T> sorter;
+                sorter.setVariant(variant);
+                sorter.sort(d, k);
+            });
+        }
+        std::cout << "\n";
+    }
+
+    // Whole inputs: ms per sort
+    for (int size = 1000; size <= maxSize; size = size * 4 <= maxSize || size == maxSize ? size * 4 : maxSize) {
+        Vector<T> input;
+        input.generateRandom(size);
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(10) << size << std::setw(6) << "ms"
+                  << std::fixed << std::setprecision(3);
+        for (InsertionVariant variant : variants) {
+            Vector<T> values(input);
+            InsertionSort<T> sorter;
+            sorter.setVariant(variant);
+
+            auto start = std::chrono::steady_clock::now();
+            sorter.sort(values);
+            std::cout << std::setw(12) << elapsedMs(start);
+
+            for (int i = 1; i < size; ++i) {
+                if (values[i] < values[i - 1]) {
+                    std::cout << "(unsorted!)";
+                    break;
+                }
+            }
+        }
+        std::cout << "\n";
+    }
+}
+
+// Linear, sentinel and binary insertion sort: finisher-sized blocks, then
+// whole random inputs up to maxSize
+void benchmarkInsertion(int maxSize) {
+    std::cout << "Insertion sort variants, random input\n"
+              << std::left << std::setw(8) << "type" << std::setw(10) << "n" << std::setw(6) << "unit"
+              << std::setw(12) << "linear" << std::setw(12) << "sentinel" << std::setw(12) << "binary" << "\n";
+
+    benchmarkInsertionOfType<int>("int", maxSize);
+    benchmarkInsertionOfType<double>("double", maxSize);
+    benchmarkInsertionOfType<char>("char", maxSize);
+}
+
+template <typename T>
+static void benchmarkBlocksOfType(const char* typeName, int blocks) {
+    using Isa = SortingKernels::Isa;
+    const int sizes[4] = {4, 8, 16, 32};
+
+    for (int n : sizes) {
+        Vector<T> input;
+        input.generateRandom(n * blocks);
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(6) << n << std::fixed << std::setprecision(1)
+                  << std::setw(12) << timeBlocks(input, n, blocks, [](T* d, int k) { insertionSortBlock(d, k); })
+                  << std::setw(12) << timeBlocks(input, n, blocks, [](T* d, int k) { SortingKernels::sortSmall(d, k, Isa::Scalar); });
+
+        for (Isa isa : {Isa::Sse4, Isa::Avx2}) {
+            if (SortingKernels::supports(isa)) {
+                std::cout << std::setw(12) << timeBlocks(input, n, blocks, [isa](T* d, int k) { SortingKernels::sortSmall(d, k, isa); });
+            } else {
+                std::cout << std::setw(12) << "n/a";
+            }
+        }
+        std::cout << "\n";
+    }
+}
+
+// Throughput of the small-block sorting kernels
+void benchmarkSmallBlocks(int blocks) {
+    std::cout << "Small-block sorting, " << blocks << " blocks per size, ns per block (active ISA: "
+              << SortingKernels::isaName(SortingKernels::activeIsa()) << ")\n"
+              << std::left << std::setw(8) << "type" << std::setw(6) << "n"
+              << std::setw(12) << "insertion" << std::setw(12) << "scalar net"
+              << std::setw(12) << "sse4.1" << std::setw(12) << "avx2" << "\n";
+
+    benchmarkBlocksOfType<int>("int", blocks);
+    benchmarkBlocksOfType<float>("float", blocks);
+    benchmarkBlocksOfType<double>("double", blocks);
+}
+
+template <typename T, std::size_t N>
+static void benchmarkNetworkSize(const char* typeName, int blocks) {
+    static_assert(N > 10 || SortingNetwork<N, T>::sortsAllZeroOneInputs(), "network does not sort");
+
+    Vector<T> input;
+    input.generateRandom(static_cast<int>(N) * blocks);
+
+    double insertionNs = timeBlocks(input, N, blocks, [](T* d, int k) { insertionSortBlock(d, k); });
+    double networkNs = timeBlocks(input, N, blocks, [](T* d, int) { SortingNetwork<N, T>::sort(d); });
+
+    std::cout << std::left << std::setw(8) << typeName << std::setw(6) << N
+              << std::setw(8) << SortingNetwork<N, T>::comparatorCount() << std::fixed << std::setprecision(1)
+              << std::setw(12) << insertionNs << std::setw(12) << networkNs << "\n";
+}
+
+template <typename T, std::size_t... Sizes>
+static void benchmarkNetworksOfType(const char* typeName, int blocks) {
+    (benchmarkNetworkSize<T, Sizes>(typeName, blocks), ...);
+}
+
+// Compile-time sorting networks against insertion sort on tiny arrays
+void benchmarkNetworks(int blocks) {
+    std::cout << "Fixed-size sorting networks, " << blocks << " blocks per size, ns per block\n"
+              << std::left << std::setw(8) << "type" << std::setw(6) << "n" << std::setw(8) << "cmps"
+              << std::setw(12) << "insertion" << std::setw(12) << "network" << "\n";
+
+    benchmarkNetworksOfType<int, 2, 3, 4, 5, 6, 7, 8, 12, 16, 24, 32>("int", blocks);
+    benchmarkNetworksOfType<float, 2, 3, 4, 5, 6, 7, 8, 12, 16, 24, 32>("float", blocks);
+    benchmarkNetworksOfType<double, 2, 3, 4, 5, 6, 7, 8, 12, 16, 24, 32>("double", blocks);
+}
+
+// The loader Vector<T>::loadFromFile used before TextParser: one fscanf per value
+template <typename T>
+static int fscanfLoad(const std::string& path, Vector<T>& values) {
+    FILE* file = fopen(path.c_str(), "r");
+    int count = 0;
+    if (file == nullptr || fscanf(file, "%d", &count) != 1) {
+        if (file) fclose(file);
+        return -1;
+    }
+
+    values.clear();
+    values.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        T value;
+        if (!TextFormat<T>::read(file, value)) {
+            fclose(file);
+            return -1;
+        }
+        values.pushBack(value);
+    }
+    fclose(file);
+    return 0;
+}
+
+template <typename T>
+static void benchmarkTextLoadOfType(const char* typeName, int size) {
+    std::string path = "/tmp/aizo-text-load.txt";
+
+    Vector<T> original;
+    original.generateRandom(size);
+    original.saveToFile(path);
+
+    FILE* file = fopen(path.c_str(), "r");
+    fseek(file, 0, SEEK_END);
+    double megabytes = ftell(file) / 1048576.0;
+    fclose(file);
+
+    Vector<T> values;
+    auto start = std::chrono::steady_clock::now();
+    fscanfLoad(path, values);
+    double baseline = elapsedMs(start);
+
+    std::cout << std::left << std::setw(8) << typeName << std::fixed << std::setprecision(1)
+              << std::setw(10) << megabytes << std::setw(10) << "fscanf"
+              << std::setw(12) << baseline << std::setw(10) << megabytes / (baseline / 1000.0) << "\n";
+
+    int hardware = ThreadPool::hardwareThreads();
+    for (int threads = 1; threads <= hardware; threads *= 2) {
+        Vector<T> parsed;
+        start = std::chrono::steady_clock::now();
+        int status = parsed.loadFromFile(path, threads);
+        double ms = elapsedMs(start);
+
+        bool same = status == 0 && parsed.getSize() == values.getSize() &&
+                    std::memcmp(parsed.getData(), values.getData(), sizeof(T) * values.getSize()) == 0;
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(10) << megabytes
+                  << std::setw(10) << (std::to_string(threads) + " thr") << std::setw(12) << ms
+                  << std::setw(10) << megabytes / (ms / 1000.0) << (same ? "" : "  MISMATCH") << "\n";
+
+        if (threads < hardware && threads * 2 > hardware) threads = hardware / 2;
+    }
+    std::remove(path.c_str());
+}
+
+// Text parsing: the old fscanf loop against TextParser at 1..N threads
+void benchmarkTextLoad(int size) {
+    std::cout << "Text loading, " << size << " values per type\n"
+              << std::left << std::setw(8) << "type" << std::setw(10) << "MB" << std::setw(10) << "parser"
+              << std::setw(12) << "ms" << std::setw(10) << "MB/s" << "\n";
+
+    benchmarkTextLoadOfType<int>("int", size);
+    benchmarkTextLoadOfType<float>("float", size);
+    benchmarkTextLoadOfType<double>("double", size);
+    benchmarkTextLoadOfType<char>("char", size);
+}
+
+// The generator Vector<T>::generateRandom used before xoshiro256**: mt19937
+// with a new distribution object per value, one pushBack at a time
+template <typename T>
+static void mt19937Generate(Vector<T>& values, int size) {
+    std::mt19937 gen(12345);
+    values.clear();
+    values.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        if constexpr (std::is_same<T, int>::value) {
+            std::uniform_int_distribution<int> distrib(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+            values.pushBack(distrib(gen));
+        } else if constexpr (std::is_same<T, double>::value) {
+            std::uniform_real_distribution<double> distrib(-1e156, 1e156);
+            values.pushBack(distrib(gen));
+        }
+    }
+}
+
+template <typename T>
+static void benchmarkGenerateOfType(const char* typeName, int size) {
+    Vector<T> baseline;
+    auto start = std::chrono::steady_clock::now();
+    mt19937Generate(baseline, size);
+    double baselineMs = elapsedMs(start);
+
+    std::cout << std::left << std::setw(8) << typeName << std::setw(10) << "mt19937" << std::fixed
+              << std::setprecision(3) << std::setw(12) << baselineMs << std::setw(12)
+              << size / (baselineMs * 1000.0) << "\n";
+
+    Vector<T> reference;
+    int hardware = ThreadPool::hardwareThreads();
+    for (int threads = 1; threads <= hardware; threads *= 2) {
+        RandomGenerator::setSeed(42);
+        Vector<T> values;
+        start = std::chrono::steady_clock::now();
+        values.generateRandom(size, threads);
+        double ms = elapsedMs(start);
+
+        if (threads == 1) reference = values;
+        bool same = std::memcmp(values.getData(), reference.getData(), sizeof(T) * size) == 0;
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(10) << (std::to_string(threads) + " thr")
+                  << std::setw(12) << ms << std::setw(12) << size / (ms * 1000.0) << (same ? "" : "  MISMATCH")
+                  << "\n";
+
+        if (threads < hardware && threads * 2 > hardware) threads = hardware / 2;
+    }
+}
+
+// Random data generation: mt19937 per value against seeded xoshiro256**
+// streams at 1..N threads (every thread count must give the same data)
+void benchmarkGenerate(int size) {
+    std::cout << "Random generation, " << size << " values per type\n"
+              << std::left << std::setw(8) << "type" << std::setw(10) << "source" << std::setw(12) << "ms"
+              << std::setw(12) << "Mvalues/s" << "\n";
+
+    benchmarkGenerateOfType<int>("int", size);
+    benchmarkGenerateOfType<double>("double", size);
+}
+
+// The writer Vector<T>::saveToFile used before TextWriter: one fprintf per value
+template <typename T>
+static void fprintfSave(const std::string& path, const Vector<T>& values) {
+    FILE* file = fopen(path.c_str(), "w");
+    fprintf(file, "%d\n", values.getSize());
+    for (int i = 0; i < values.getSize(); ++i) {
+        if constexpr (std::is_same<T, int>::value) fprintf(file, "%d\n", values[i]);
+        else if constexpr (std::is_same<T, float>::value) fprintf(file, "%f\n", values[i]);
+        else if constexpr (std::is_same<T, double>::value) fprintf(file, "%lf\n", values[i]);
+        else fprintf(file, "%c\n", values[i]);
+    }
+    fclose(file);
+}
+
+static double fileMegabytes(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "r");
+    fseek(file, 0, SEEK_END);
+    double megabytes = ftell(file) / 1048576.0;
+    fclose(file);
+    return megabytes;
+}
+
+template <typename T>
+static void benchmarkTextSaveOfType(const char* typeName, int size) {
+    std::string path = "/tmp/aizo-text-save.txt";
+
+    Vector<T> values;
+    values.generateRandom(size);
+
+    auto start = std::chrono::steady_clock::now();
+    fprintfSave(path, values);
+    double baseline = elapsedMs(start);
+    double megabytes = fileMegabytes(path);
+
+    std::cout << std::left << std::setw(8) << typeName << std::fixed << std::setprecision(1)
+              << std::setw(10) << megabytes << std::setw(10) << "fprintf" << std::setw(12) << baseline
+              << std::setw(10) << megabytes / (baseline / 1000.0) << "\n";
+
+    int hardware = ThreadPool::hardwareThreads();
+    for (int threads = 1; threads <= hardware; threads *= 2) {
+        start = std::chrono::steady_clock::now();
+        values.saveToFile(path, threads);
+        double ms = elapsedMs(start);
+        megabytes = fileMegabytes(path);
+
+        // Exact round trip: the reloaded values must match bit for bit
+        Vector<T> reloaded;
+        bool exact = reloaded.loadFromFile(path) == 0 && reloaded.getSize() == values.getSize() &&
+                     std::memcmp(reloaded.getData(), values.getData(), sizeof(T) * values.getSize()) == 0;
+
+        std::cout << std::left << std::setw(8) << typeName << std::setw(10) << megabytes
+                  << std::setw(10) << (std::to_string(threads) + " thr") << std::setw(12) << ms
+                  << std::setw(10) << megabytes / (ms / 1000.0) << (exact ? "exact" : "NOT EXACT") << "\n";
+
+        if (threads < hardware && threads * 2 > hardware) threads = hardware / 2;
+    }
+    std::remove(path.c_str());
+}
+
+// Text output: the old fprintf loop against TextWriter at 1..N threads
+void benchmarkTextSave(int size) {
+    std::cout << "Text saving, " << size << " values per type\n"
+              << std::left << std::setw(8) << "type" << std::setw(10) << "MB" << std::setw(10) << "writer"
+              << std::setw(12) << "ms" << std::setw(10) << "MB/s" << "round trip\n";
+
+    benchmarkTextSaveOfType<int>("int", size);
+    benchmarkTextSaveOfType<float>("float", size);
+    benchmarkTextSaveOfType<double>("double", size);
+    benchmarkTextSaveOfType<char>("char", size);
+}
+
+void printUsage() {
+    std::cout << "\nUsage:\n"
+              << "./benchmarks list-allocator [size] [repeats]\n"
+              << "./benchmarks list-sort [size]\n"
+              << "./benchmarks vector-growth [size] [repeats]\n"
+              << "./benchmarks introsort [size]\n"
+              << "./benchmarks types [size]\n"
+              << "./benchmarks small-blocks [blocks]\n"
+              << "./benchmarks networks [blocks]\n"
+              << "./benchmarks text-load [size]\n"
+              << "./benchmarks text-save [size]\n"
+              << "./benchmarks generate [size]\n"
+              << "./benchmarks heaps [maxSize]\n"
+              << "./benchmarks insertion [maxSize]\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string benchmark = argv[1];
+    int size = (argc >= 3) ? std::stoi(argv[2]) : 1000000;
+    int repeats = (argc >= 4) ? std::stoi(argv[3]) : 5;
+
+    if (benchmark == "list-allocator") {
+        benchmarkListAllocator(size, repeats);
+    } else if (benchmark == "list-sort") {
+        benchmarkListSort(size);
+    } else if (benchmark == "vector-growth") {
+        benchmarkVectorGrowth(size, repeats);
+    } else if (benchmark == "introsort") {
+        benchmarkIntroSort(size);
+    } else if (benchmark == "types") {
+        benchmarkTypes(argc >= 3 ? size : 160000);
+    } else if (benchmark == "small-blocks") {
+        benchmarkSmallBlocks(argc >= 3 ? size : 200000);
+    } else if (benchmark == "networks") {
+        benchmarkNetworks(argc >= 3 ? size : 200000);
+    } else if (benchmark == "text-load") {
+        benchmarkTextLoad(size);
+    } else if (benchmark == "text-save") {
+        benchmarkTextSave(size);
+    } else if (benchmark == "generate") {
+        benchmarkGenerate(argc >= 3 ? size : 10000000);
+    } else if (benchmark == "insertion") {
+        benchmarkInsertion(argc >= 3 ? size : 160000);
+    } else if (benchmark == "heaps") {
+        benchmarkHeaps(argc >= 3 ? size : 10000000);
+    } else {
+        std::cerr << "Unknown benchmark: " << benchmark << "\n";
+        printUsage();
+        return 1;
+    }
+
+    return 0;
+}
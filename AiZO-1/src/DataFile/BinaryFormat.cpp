@@ -0,0 +1,148 @@
+#include "BinaryFormat.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char binaryMagic[4] = {'A', 'Z', 'S', 'B'};
+
+const char* BinaryFormat::typeName(uint8_t tag) {
+    switch (tag) {
+        case Int: return "int";
+        case Float: return "float";
+        case Double: return "double";
+        case Char: return "char";
+        default: return "unknown";
+    }
+}
+
+bool BinaryFormat::hostIsLittleEndian() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+bool BinaryFormat::isBinaryFile(const std::string& filename) {
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    char magic[4];
+    bool binary = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                  std::memcmp(magic, binaryMagic, sizeof(magic)) == 0;
+    fclose(file);
+    return binary;
+}
+
+BinaryHeader BinaryFormat::makeHeader(uint8_t tag, uint8_t elementSize, uint64_t count) {
+    BinaryHeader header;
+    std::memcpy(header.magic, binaryMagic, sizeof(header.magic));
+    header.version = version;
+    header.typeTag = tag;
+    header.littleEndian = hostIsLittleEndian() ? 1 : 0;
+    header.elementSize = elementSize;
+    header.count = count;
+    return header;
+}
+
+int BinaryFormat::validate(const BinaryHeader& header, uint8_t expectedTag, size_t elementSize, size_t fileSize,
+                           uint64_t& count) {
+    if (std::memcmp(header.magic, binaryMagic, sizeof(header.magic)) != 0) {
+        std::cerr << "Not a binary data file.\n";
+        return -1;
+    }
+    if (header.version != version) {
+        std::cerr << "Unsupported binary format version: " << static_cast<int>(header.version) << "\n";
+        return -1;
+    }
+    if (header.typeTag != expectedTag || header.elementSize != elementSize) {
+        std::cerr << "Binary file holds " << typeName(header.typeTag) << " values, not "
+                  << typeName(expectedTag) << ".\n";
+        return -1;
+    }
+
+    count = header.count;
+    if ((header.littleEndian != 0) != hostIsLittleEndian()) {
+        swapBytes(&count, sizeof(count), 1);
+    }
+
+    if (count > (fileSize - sizeof(BinaryHeader)) / elementSize ||
+        sizeof(BinaryHeader) + count * elementSize != fileSize) {
+        std::cerr << "Binary file size does not match its header (" << count << " elements).\n";
+        return -1;
+    }
+    return 0;
+}
+
+void BinaryFormat::swapBytes(void* data, size_t elementSize, size_t count) {
+    unsigned char* bytes = static_cast<unsigned char*>(data);
+    for (size_t i = 0; i < count; ++i, bytes += elementSize) {
+        for (size_t low = 0, high = elementSize - 1; low < high; ++low, --high) {
+            std::swap(bytes[low], bytes[high]);
+        }
+    }
+}
+
+MappedFile::MappedFile() : data(nullptr), size(0) {}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+int MappedFile::open(const std::string& filename) {
+    close();
+
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        std::cerr << "File can not be read: " << filename << "\n";
+        return -1;
+    }
+
+    struct stat info;
+    if (fstat(descriptor, &info) != 0) {
+        std::cerr << "Could not stat file: " << filename << "\n";
+        ::close(descriptor);
+        return -1;
+    }
+
+    size = static_cast<size_t>(info.st_size);
+    if (size > 0) {
+        // Prefault the whole mapping in one call instead of a fault per page
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, descriptor, 0);
+        if (data == MAP_FAILED) {
+            data = nullptr;
+            size = 0;
+            std::cerr << "Could not map file: " << filename << "\n";
+            ::close(descriptor);
+            return -1;
+        }
+        // One front-to-back copy follows; let the kernel read ahead
+        madvise(data, size, MADV_SEQUENTIAL);
+    }
+
+    ::close(descriptor);
+    return 0;
+}
+
+void MappedFile::close() {
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+    data = nullptr;
+    size = 0;
+}
+
+const unsigned char* MappedFile::getData() const {
+    return static_cast<const unsigned char*>(data);
+}
+
+size_t MappedFile::getSize() const {
+    return size;
+}
@@ -0,0 +1,76 @@
+#ifndef BINARY_FORMAT_H
+#define BINARY_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// Fixed 16-byte header in front of the raw element array of a binary
+// dataset. The payload is the values' in-memory representation, so loading
+// is one copy out of a memory map instead of a parse per element.
+struct BinaryHeader {
+    char magic[4];          // "AZSB"
+    uint8_t version;
+    uint8_t typeTag;        // BinaryFormat::Int, Float, Double or Char
+    uint8_t littleEndian;   // byte order of the payload (1 = little-endian)
+    uint8_t elementSize;
+    uint64_t count;         // stored in the payload's byte order
+};
+
+static_assert(sizeof(BinaryHeader) == 16, "BinaryHeader must stay 16 bytes");
+
+class BinaryFormat {
+public:
+    enum TypeTag : uint8_t { Int = 1, Float = 2, Double = 3, Char = 4 };
+
+    static constexpr uint8_t version = 1;
+
+    template <typename T>
+    static constexpr uint8_t typeTag() {
+        if constexpr (std::is_same<T, int>::value) return Int;
+        else if constexpr (std::is_same<T, float>::value) return Float;
+        else if constexpr (std::is_same<T, double>::value) return Double;
+        else if constexpr (std::is_same<T, char>::value) return Char;
+        else return 0;
+    }
+
+    static const char* typeName(uint8_t tag);
+    static bool hostIsLittleEndian();
+
+    // True if the file starts with the binary magic (text files never do)
+    static bool isBinaryFile(const std::string& filename);
+
+    static BinaryHeader makeHeader(uint8_t tag, uint8_t elementSize, uint64_t count);
+
+    // Check a header against the expected element type and the file size;
+    // prints the reason and returns -1 on mismatch. count is returned in
+    // host byte order.
+    static int validate(const BinaryHeader& header, uint8_t expectedTag, size_t elementSize, size_t fileSize,
+                        uint64_t& count);
+
+    // Reverse the bytes of every element in place
+    static void swapBytes(void* data, size_t elementSize, size_t count);
+};
+
+// Read-only memory map of a whole file, unmapped on destruction
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    int open(const std::string& filename);
+    void close();
+
+    const unsigned char* getData() const;
+    size_t getSize() const;
+
+private:
+    void* data;
+    size_t size;
+};
+
+#endif // BINARY_FORMAT_H
@@ -0,0 +1,84 @@
+#ifndef TEXTFORMAT_H
+#define TEXTFORMAT_H
+
+#include <charconv>
+#include <cstdio>
+#include <type_traits>
+
+// One value per line, as read by Vector<T>::loadFromFile and written by
+// Vector<T>::saveToFile, for code that streams files value by value.
+// Numbers are written in the shortest form that parses back to the same
+// bits (std::to_chars) and parsed back with std::from_chars, so a
+// save/load round trip is exact.
+template <typename T>
+struct TextFormat {
+    static_assert(std::is_same<T, int>::value || std::is_same<T, float>::value ||
+                  std::is_same<T, double>::value || std::is_same<T, char>::value,
+                  "TextFormat supports int, float, double and char");
+
+    static bool read(FILE* file, T& value) {
+        if constexpr (std::is_same<T, int>::value) {
+            return fscanf(file, "%d", &value) == 1;
+        } else if constexpr (std::is_same<T, float>::value) {
+            return fscanf(file, "%f", &value) == 1;
+        } else if constexpr (std::is_same<T, double>::value) {
+            return fscanf(file, "%lf", &value) == 1;
+        } else {
+            return fscanf(file, " %c", &value) == 1;
+        }
+    }
+
+    static bool isSpace(char c) {
+        // ' ' or one of '\t' '\n' '\v' '\f' '\r' (9..13); two compares vectorize well
+        return c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t';
+    }
+
+    // Parse one value at p and step past it; the value must end at whitespace
+    // or at 'end'. A leading '+' is accepted like scanf does. As with "%c",
+    // a char value is the single byte at p.
+    static bool parse(const char*& p, const char* end, T& value) {
+        if constexpr (std::is_same<T, char>::value) {
+            if (p == end) return false;
+            value = *p++;
+            return true;
+        } else {
+            const char* begin = (p < end && *p == '+') ? p + 1 : p;
+            auto result = std::from_chars(begin, end, value);
+            if (result.ec != std::errc() || (result.ptr < end && !isSpace(*result.ptr))) {
+                return false;
+            }
+            p = result.ptr;
+            return true;
+        }
+    }
+
+    // Longest output of format(), newline included
+    static constexpr int maxChars = 32;
+
+    // Write value and a newline at out; returns the end of what was written
+    static char* format(char* out, const T& value) {
+        if constexpr (std::is_same<T, char>::value) {
+            *out++ = value;
+        } else {
+            out = std::to_chars(out, out + maxChars - 1, value).ptr;
+        }
+        *out++ = '\n';
+        return out;
+    }
+
+    static void write(FILE* file, const T& value) {
+        char text[maxChars];
+        fwrite(text, 1, format(text, value) - text, file);
+    }
+
+    // NaNs order after every number so merges see a strict weak order
+    static bool before(const T& a, const T& b) {
+        if constexpr (std::is_floating_point<T>::value) {
+            return a < b || (b != b && a == a);
+        } else {
+            return a < b;
+        }
+    }
+};
+
+#endif // TEXTFORMAT_H
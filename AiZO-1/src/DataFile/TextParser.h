@@ -0,0 +1,59 @@
+#ifndef TEXTPARSER_H
+#define TEXTPARSER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "TextFormat.h"
+#include "../ThreadPool/ThreadPool.h"
+
+// Parallel loader for text data files (count header, then whitespace
+// separated values). The file is memory-mapped and cut into one part per
+// thread at whitespace boundaries. A first pass counts the values of every
+// part, which fixes where each part's values go and lets the header count
+// be checked; a second pass parses every part with TextFormat<T>::parse straight
+// into its slice of the caller's buffer, so the values keep input order.
+// As with "%c", every non-whitespace byte is one char value.
+template <typename T>
+class TextParser {
+public:
+    // threads = 0 uses every hardware thread
+    explicit TextParser(int threads = 0);
+
+    // Map the file, read the header and count the values; -1 on mismatch
+    int open(const std::string& filename);
+    long long getCount() const;
+
+    // Parse the getCount() values of the opened file into 'out'
+    int parseInto(T* out);
+
+private:
+    // One slice of the body; values go to out[offset, offset + count)
+    struct Part {
+        const char* begin;
+        const char* end;
+        long long count;
+        long long offset;
+        long long errorIndex;  // global index of the first bad value, -1 if none
+    };
+
+    static constexpr long long minPartBytes = 1LL << 20;
+
+    int threads;
+    MappedFile file;
+    long long count;
+    std::vector<Part> parts;
+    std::unique_ptr<ThreadPool> pool;
+
+    void split(const char* begin, const char* end);
+    template <typename Work>
+    void forEachPart(Work work);
+
+    static long long countValues(const char* begin, const char* end);
+    static long long parsePart(const Part& part, T* out);
+};
+
+#include "TextParser.tpp"
+
+#endif // TEXTPARSER_H
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <type_traits>
+
+template <typename T>
+TextParser<T>::TextParser(int threads)
+    : threads(threads > 0 ? threads : ThreadPool::hardwareThreads()), count(0) {}
+
+template <typename T>
+long long TextParser<T>::getCount() const {
+    return count;
+}
+
+template <typename T>
+int TextParser<T>::open(const std::string& filename) {
+    count = 0;
+    parts.clear();
+
+    if (file.open(filename) != 0) {
+        return -1;
+    }
+
+    const char* position = reinterpret_cast<const char*>(file.getData());
+    const char* end = position + file.getSize();
+
+    while (position < end && TextFormat<T>::isSpace(*position)) ++position;
+    long long declared = -1;
+    auto header = std::from_chars(position, end, declared);
+    if (header.ec != std::errc() || declared < 0) {
+        std::cerr << "Error reading number of elements.\n";
+        return -1;
+    }
+
+    split(header.ptr, end);
+    forEachPart([](Part& part) { part.count = countValues(part.begin, part.end); });
+
+    long long found = 0;
+    for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+        parts[i].offset = found;
+        found += parts[i].count;
+    }
+
+    if (found != declared) {
+        std::cerr << "File declares " << declared << " elements but holds " << found << ".\n";
+        return -1;
+    }
+    count = found;
+    return 0;
+}
+
+template <typename T>
+int TextParser<T>::parseInto(T* out) {
+    forEachPart([out](Part& part) { part.errorIndex = parsePart(part, out); });
+
+    for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+        if (parts[i].errorIndex >= 0) {
+            std::cerr << "Error reading value " << parts[i].errorIndex << " of " << count << ".\n";
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Cut at roughly equal byte offsets, moved forward to the next whitespace
+// so that no value straddles two parts
+template <typename T>
+void TextParser<T>::split(const char* begin, const char* end) {
+    long long bytes = end - begin;
+    long long wanted = std::max(1LL, std::min<long long>(threads, bytes / minPartBytes));
+
+    const char* start = begin;
+    for (long long i = 1; i <= wanted; ++i) {
+        const char* cut = (i == wanted) ? end : begin + bytes * i / wanted;
+        if (cut < start) cut = start;
+        while (cut < end && !TextFormat<T>::isSpace(*cut)) ++cut;
+
+        parts.push_back(Part{start, cut, 0, 0, -1});
+        start = cut;
+    }
+}
+
+// Run work(part) for every part, on the pool when there is more than one
+template <typename T>
+template <typename Work>
+void TextParser<T>::forEachPart(Work work) {
+    if (static_cast<int>(parts.size()) <= 1) {
+        for (int i = 0; i < static_cast<int>(parts.size()); ++i) work(parts[i]);
+        return;
+    }
+
+    if (!pool) {
+        pool.reset(new ThreadPool(std::min<int>(threads, static_cast<int>(parts.size()))));
+    }
+    for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+        Part* part = &parts[i];
+        pool->submit([part, &work]() { work(*part); });
+    }
+    pool->waitIdle();
+}
+
+// A value starts wherever a non-space byte follows a space (or the part's
+// start). Comparing neighbours keeps the loop free of carried state, and
+// summing fixed 64-byte blocks into a byte lets GCC vectorize it at -O2.
+template <typename T>
+long long TextParser<T>::countValues(const char* begin, const char* end) {
+    if (begin == end) {
+        return 0;
+    }
+
+    // For char every non-space byte is a value of its own
+    auto startsValue = [](const char* p) {
+        if constexpr (std::is_same<T, char>::value) {
+            return !TextFormat<T>::isSpace(*p);
+        } else {
+            return TextFormat<T>::isSpace(p[-1]) & !TextFormat<T>::isSpace(*p);
+        }
+    };
+
+    long long values = !TextFormat<T>::isSpace(*begin);
+    const char* p = begin + 1;
+
+    while (end - p >= 64) {
+        unsigned char block = 0;
+        for (int i = 0; i < 64; ++i) {
+            block += startsValue(p + i);
+        }
+        values += block;
+        p += 64;
+    }
+    for (; p < end; ++p) {
+        values += startsValue(p);
+    }
+    return values;
+}
+
+// Returns the global index of the first value that does not parse, or -1
+template <typename T>
+long long TextParser<T>::parsePart(const Part& part, T* out) {
+    T* target = out + part.offset;
+    const char* p = part.begin;
+
+    for (long long i = 0; i < part.count; ++i) {
+        while (TextFormat<T>::isSpace(*p)) ++p;
+
+        if (!TextFormat<T>::parse(p, part.end, target[i])) {
+            return part.offset + i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,49 @@
+#ifndef TEXTREADER_H
+#define TEXTREADER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "TextFormat.h"
+
+// Streaming reader for text data files (count header, then whitespace
+// separated values). The file is read in large blocks with single fread
+// calls and every value is parsed in place by TextFormat<T>::parse
+// (std::from_chars), so memory stays at one buffer however large the file
+// is. For code that consumes values in order, such as merges; TextParser
+// loads a whole file faster.
+template <typename T>
+class TextReader {
+public:
+    static constexpr size_t defaultBufferSize = 1 << 20;
+    static constexpr size_t minBufferSize = 4096;
+
+    explicit TextReader(size_t bufferBytes = defaultBufferSize);
+    ~TextReader();
+
+    TextReader(const TextReader&) = delete;
+    TextReader& operator=(const TextReader&) = delete;
+
+    int open(const std::string& filename);
+    void close();
+
+    // False if the header is missing, malformed or negative
+    bool readHeader(long long& count);
+    // False at the end of the file or on a malformed value
+    bool read(T& value);
+
+private:
+    FILE* file;
+    std::vector<char> buffer;
+    const char* position;
+    const char* end;
+    bool endOfFile;
+
+    bool refill();
+    bool skipSpace();
+    const char* tokenEnd();
+};
+
+#include "TextReader.tpp"
+
+#endif // TEXTREADER_H
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+
+template <typename T>
+TextReader<T>::TextReader(size_t bufferBytes)
+    : file(nullptr), buffer(std::max(bufferBytes, minBufferSize)), position(nullptr), end(nullptr), endOfFile(true) {}
+
+template <typename T>
+TextReader<T>::~TextReader() {
+    close();
+}
+
+template <typename T>
+int TextReader<T>::open(const std::string& filename) {
+    close();
+
+    file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        std::cerr << "File can not be read: " << filename << "\n";
+        return -1;
+    }
+    // We read whole buffers, so stdio's own buffering only adds a copy
+    setvbuf(file, nullptr, _IONBF, 0);
+
+    position = end = buffer.data();
+    endOfFile = false;
+    return 0;
+}
+
+template <typename T>
+void TextReader<T>::close() {
+    if (file != nullptr) {
+        fclose(file);
+        file = nullptr;
+    }
+    position = end = nullptr;
+    endOfFile = true;
+}
+
+template <typename T>
+bool TextReader<T>::readHeader(long long& count) {
+    if (!skipSpace()) {
+        return false;
+    }
+
+    const char* last = tokenEnd();
+    if (last == nullptr) {
+        return false;
+    }
+    auto result = std::from_chars(position, last, count);
+    if (result.ec != std::errc() || result.ptr != last || count < 0) {
+        return false;
+    }
+    position = last;
+    return true;
+}
+
+template <typename T>
+bool TextReader<T>::read(T& value) {
+    if (!skipSpace()) {
+        return false;
+    }
+
+    // Usually the value ends well inside the buffer and parses in one go
+    const char* start = position;
+    if (TextFormat<T>::parse(position, end, value) && (position < end || endOfFile)) {
+        return true;
+    }
+
+    // It may run past the buffer: load the rest of it and parse again
+    position = start;
+    const char* last = tokenEnd();
+    return last != nullptr && TextFormat<T>::parse(position, last, value);
+}
+
+// Move the unread tail to the front and fill the rest from the file;
+// false if nothing new arrived
+template <typename T>
+bool TextReader<T>::refill() {
+    size_t kept = static_cast<size_t>(end - position);
+    if (endOfFile || kept == buffer.size()) {
+        return false;
+    }
+
+    std::memmove(buffer.data(), position, kept);
+    size_t wanted = buffer.size() - kept;
+    size_t got = fread(buffer.data() + kept, 1, wanted, file);
+
+    position = buffer.data();
+    end = position + kept + got;
+    endOfFile = got < wanted;  // fread only comes up short at end of file or on error
+    return got > 0;
+}
+
+// Step over whitespace; false once only whitespace is left
+template <typename T>
+bool TextReader<T>::skipSpace() {
+    for (;;) {
+        while (position < end && TextFormat<T>::isSpace(*position)) ++position;
+        if (position < end) {
+            return true;
+        }
+        if (!refill()) {
+            return false;
+        }
+    }
+}
+
+// End of the token at position, refilling until whitespace or the end of
+// the file follows it; nullptr if the token does not fit in the buffer
+template <typename T>
+const char* TextReader<T>::tokenEnd() {
+    const char* p = position;
+    for (;;) {
+        while (p < end && !TextFormat<T>::isSpace(*p)) ++p;
+        if (p < end || endOfFile) {
+            return p;
+        }
+
+        size_t scanned = static_cast<size_t>(p - position);
+        if (!refill()) {
+            return endOfFile ? end : nullptr;
+        }
+        p = position + scanned;
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef TEXTWRITER_H
+#define TEXTWRITER_H
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "TextFormat.h"
+#include "../ThreadPool/ThreadPool.h"
+
+// Buffered writer for text data files. Values are formatted with
+// TextFormat<T>::format (std::to_chars, exact round trip) into a large
+// buffer that goes out in single fwrite calls. writeAll() can format on
+// several threads: every round, each thread fills its own buffer from
+// its slice of the array, and the buffers are written in slice order.
+template <typename T>
+class TextWriter {
+public:
+    static constexpr size_t defaultBufferSize = 1 << 20;
+    static constexpr size_t minBufferSize = 4096;
+
+    // threads = 0 uses every hardware thread
+    explicit TextWriter(int threads = 1, size_t bufferBytes = defaultBufferSize);
+    ~TextWriter();
+
+    TextWriter(const TextWriter&) = delete;
+    TextWriter& operator=(const TextWriter&) = delete;
+
+    int open(const std::string& filename);
+    void writeHeader(long long count);
+    void append(const T& value);
+    void writeAll(const T* values, long long count);
+
+    // Flush and close; -1 if anything failed to reach the file
+    int close();
+
+private:
+    static constexpr long long valuesPerSlice = 1 << 16;
+
+    FILE* file;
+    std::string filename;
+    std::vector<char> buffer;
+    size_t used;
+    bool failed;
+    int threads;
+    std::unique_ptr<ThreadPool> pool;
+    std::vector<std::vector<char>> sliceBuffers;
+
+    void flush();
+    void writeBytes(const char* data, size_t size);
+};
+
+#include "TextWriter.tpp"
+
+#endif // TEXTWRITER_H
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+template <typename T>
+TextWriter<T>::TextWriter(int threads, size_t bufferBytes)
+    : file(nullptr), buffer(std::max(bufferBytes, minBufferSize)), used(0), failed(false),
+      threads(threads > 0 ? threads : ThreadPool::hardwareThreads()) {}
+
+template <typename T>
+TextWriter<T>::~TextWriter() {
+    close();
+}
+
+template <typename T>
+int TextWriter<T>::open(const std::string& name) {
+    close();
+
+    filename = name;
+    failed = false;
+    file = fopen(filename.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "Could not open file for writing: " << filename << std::endl;
+        return -1;
+    }
+    // We hand stdio whole buffers, so its own buffering only adds a copy
+    setvbuf(file, nullptr, _IONBF, 0);
+    return 0;
+}
+
+template <typename T>
+void TextWriter<T>::writeHeader(long long count) {
+    if (buffer.size() - used < 32) flush();
+    used += std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), count).ptr - (buffer.data() + used);
+    buffer[used++] = '\n';
+}
+
+template <typename T>
+void TextWriter<T>::append(const T& value) {
+    if (buffer.size() - used < static_cast<size_t>(TextFormat<T>::maxChars)) flush();
+    used = TextFormat<T>::format(buffer.data() + used, value) - buffer.data();
+}
+
+template <typename T>
+void TextWriter<T>::writeAll(const T* values, long long count) {
+    long long slices = std::min<long long>(threads, (count + valuesPerSlice - 1) / valuesPerSlice);
+    if (slices <= 1) {
+        for (long long i = 0; i < count; ++i) append(values[i]);
+        return;
+    }
+
+    flush();
+    if (!pool) {
+        pool.reset(new ThreadPool(threads));
+    }
+    sliceBuffers.resize(static_cast<size_t>(slices));
+    std::vector<size_t> sliceUsed(static_cast<size_t>(slices));
+
+    // Each round formats slices * valuesPerSlice values, then writes them in order
+    for (long long first = 0; first < count; first += slices * valuesPerSlice) {
+        for (long long s = 0; s < slices; ++s) {
+            long long begin = std::min(count, first + s * valuesPerSlice);
+            long long end = std::min(count, begin + valuesPerSlice);
+
+            std::vector<char>& out = sliceBuffers[s];
+            out.resize(static_cast<size_t>(valuesPerSlice * TextFormat<T>::maxChars));
+            size_t* length = &sliceUsed[s];
+
+            pool->submit([values, begin, end, &out, length]() {
+                char* position = out.data();
+                for (long long i = begin; i < end; ++i) {
+                    position = TextFormat<T>::format(position, values[i]);
+                }
+                *length = position - out.data();
+            });
+        }
+        pool->waitIdle();
+
+        for (long long s = 0; s < slices; ++s) {
+            writeBytes(sliceBuffers[s].data(), sliceUsed[s]);
+        }
+    }
+}
+
+template <typename T>
+int TextWriter<T>::close() {
+    if (file == nullptr) {
+        return failed ? -1 : 0;
+    }
+
+    flush();
+    if (fclose(file) != 0) {
+        failed = true;
+    }
+    file = nullptr;
+
+    if (failed) {
+        std::cerr << "Error writing file: " << filename << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+template <typename T>
+void TextWriter<T>::flush() {
+    writeBytes(buffer.data(), used);
+    used = 0;
+}
+
+template <typename T>
+void TextWriter<T>::writeBytes(const char* data, size_t size) {
+    if (size > 0 && !failed && fwrite(data, 1, size, file) != size) {
+        failed = true;
+    }
+}
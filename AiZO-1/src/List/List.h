@@ -5,7 +5,13 @@
 #include <vector>
 #include <algorithm>
 #include <type_traits>
+#include <iterator>
+#include <cstddef>
 #include "../RandomGenerator/RandomGenerator.h"
+#include "NodePool.h"
+#include "../DataFile/BinaryFormat.h"
+#include "../DataFile/TextParser.h"
+#include "../DataFile/TextWriter.h"
 
 // Node class template declaration
 template <typename T>
@@ -19,24 +25,90 @@ public:
     explicit Node(T val) : value(val), next(nullptr), previous(nullptr) {}
 };
 
+// Bidirectional iterator over existing list nodes (no allocation)
+template <typename T, bool IsConst>
+class ListIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+    using reference = typename std::conditional<IsConst, const T&, T&>::type;
+    using NodePointer = typename std::conditional<IsConst, const Node<T>*, Node<T>*>::type;
+
+    ListIterator(NodePointer node = nullptr, NodePointer last = nullptr) : node(node), last(last) {}
+
+    // Mutable iterators convert to const ones
+    template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+    ListIterator(const ListIterator<T, OtherConst>& other) : node(other.getNode()), last(other.getLast()) {}
+
+    reference operator*() const { return node->value; }
+    pointer operator->() const { return &node->value; }
+
+    ListIterator& operator++() { node = node->next; return *this; }
+    ListIterator operator++(int) { ListIterator copy = *this; node = node->next; return copy; }
+
+    // Decrementing end() steps back onto the tail
+    ListIterator& operator--() { node = node ? node->previous : last; return *this; }
+    ListIterator operator--(int) { ListIterator copy = *this; --(*this); return copy; }
+
+    bool operator==(const ListIterator& other) const { return node == other.node; }
+    bool operator!=(const ListIterator& other) const { return node != other.node; }
+
+    NodePointer getNode() const { return node; }
+    NodePointer getLast() const { return last; }
+
+private:
+    NodePointer node;
+    NodePointer last;   // Tail of the list, target of --end()
+};
+
+// Non-owning view over a run of list nodes
+template <typename Iterator>
+class ListRange {
+public:
+    ListRange(Iterator first, Iterator last, int count) : first(first), last(last), count(count) {}
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return last; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+
+private:
+    Iterator first;
+    Iterator last;
+    int count;
+};
+
 // List class template declaration
-template <typename T>
+template <typename T, typename Allocator = NodePool<T>>
 class List {
 private:
     Node<T>* head;
     Node<T>* tail;
     int size;
+    Allocator allocator;
 
     void generateSortedPortion(int size, int start, int end);
     void generateRandomPortion(int size, int start);
 
+    // Same key-to-value mapping as Vector<T>::fromKey
+    static T fromKey(long long key, long long keyCount);
+
 public:
+    using iterator = ListIterator<T, false>;
+    using const_iterator = ListIterator<T, true>;
+
     // Constructor and destructor
     List();
     ~List();
 
-    // File operations
-    int loadFromFile(const std::string &filename);
+    List(const List&) = delete;
+    List& operator=(const List&) = delete;
+
+    // File operations; text is parsed on 'threads' threads (0 = all)
+    int loadFromFile(const std::string &filename, int threads = 0);
+    int loadFromBinaryFile(const std::string& filename);
     
     // Operations
     void insertAtHead(T value);
@@ -55,11 +127,23 @@ public:
     // Sorting and manipulation
     void sortList();
     Node<T>* getList();
+    const Node<T>* getList() const;
+
+    // Traversal without copying
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    ListRange<iterator> view();
+    ListRange<const_iterator> view() const;
     
     // Utility
     int getSize() const;
     void printList() const;
     void saveToFile(const std::string& filename) const;
+    int saveToBinaryFile(const std::string& filename) const;
     int checkSortedList() const;
 };
 
@@ -3,97 +3,47 @@
 #include <algorithm>
 #include <vector>
 #include <type_traits>
+#include <cstdio>
+#include <cstring>
 
 // Constructor
-template <typename T>
-List<T>::List() 
+template <typename T, typename Allocator>
+List<T, Allocator>::List() 
     : head(nullptr), 
       tail(nullptr), 
       size(0) {}
 
 // Destructor
-template <typename T>
-List<T>::~List() {
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() {
     clear();
 }
 
 // Load list data from file
-template <typename T>
-int List<T>::loadFromFile(const std::string &filename) {
+template <typename T, typename Allocator>
+int List<T, Allocator>::loadFromFile(const std::string &filename, int threads) {
     clear();
 
-    FILE *file = fopen(filename.c_str(), "r");
-    if (file == nullptr) {
-        std::cout << "File can not be read." << std::endl;
+    TextParser<T> parser(threads);
+    if (parser.open(filename) != 0) {
         return -1;
     }
 
-    int N;
-    if (fscanf(file, "%d", &N) != 1) {
-        std::cerr << "Error reading number of elements.\n";
-        fclose(file);
+    std::vector<T> values(static_cast<size_t>(parser.getCount()));
+    if (parser.parseInto(values.data()) != 0) {
         return -1;
     }
 
-
-    // Handle different types for file reading
-    if (std::is_same<T, int>::value) {
-        for (int i = 0; i < N; i++) {
-            int value;
-
-            if (fscanf(file, "%d", &value) != 1) {
-                std::cerr << "Error reading int value.\n";
-                fclose(file);
-                return -1;
-            }
-
-            insertAtTail(static_cast<T>(value));
-        }
-    } 
-    else if (std::is_same<T, float>::value) {
-        for (int i = 0; i < N; i++) {
-            float value;
-            if (fscanf(file, "%f", &value) != 1) {
-                std::cerr << "Error reading int value.\n";
-                fclose(file);
-                return -1;
-            }            insertAtTail(static_cast<T>(value));
-        }
+    for (const T& value : values) {
+        insertAtTail(value);
     }
-    else if (std::is_same<T, double>::value) {
-        for (int i = 0; i < N; i++) {
-            double value;
-            if (fscanf(file, "%lf", &value) != 1) {
-                std::cerr << "Error reading int value.\n";
-                fclose(file);
-                return -1;
-            }            insertAtTail(static_cast<T>(value));
-        }
-    }
-    else if (std::is_same<T, char>::value) {
-        for (int i = 0; i < N; i++) {
-            char value;
-            if (fscanf(file, "%c", &value) != 1) {
-                std::cerr << "Error reading int value.\n";
-                fclose(file);
-                return -1;
-            }            insertAtTail(static_cast<T>(value));
-        }
-    }
-    else {
-        std::cout << "Unsupported type for file loading" << std::endl;
-        fclose(file);
-        return -1;
-    }
-
-    fclose(file);
     return 0;
 }
 
 // Insert at the beginning of the list
-template <typename T>
-void List<T>::insertAtHead(T value) {
-    Node<T>* newNode = new Node<T>(value);
+template <typename T, typename Allocator>
+void List<T, Allocator>::insertAtHead(T value) {
+    Node<T>* newNode = allocator.create(value);
 
     if (!head) {
         head = tail = newNode;
@@ -106,9 +56,9 @@ void List<T>::insertAtHead(T value) {
 }
 
 // Insert at the end of the list
-template <typename T>
-void List<T>::insertAtTail(T value) {
-    Node<T>* newNode = new Node<T>(value);
+template <typename T, typename Allocator>
+void List<T, Allocator>::insertAtTail(T value) {
+    Node<T>* newNode = allocator.create(value);
 
     if (!tail) {
         head = tail = newNode;
@@ -121,8 +71,8 @@ void List<T>::insertAtTail(T value) {
 }
 
 // Delete a node with specific value
-template <typename T>
-void List<T>::deleteNode(T value) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::deleteNode(T value) {
     Node<T>* current = head;
 
     while (current) {
@@ -139,7 +89,7 @@ void List<T>::deleteNode(T value) {
                 tail = current->previous;
             }
 
-            delete current;
+            allocator.destroy(current);
             size--;
             return;
         }
@@ -148,8 +98,8 @@ void List<T>::deleteNode(T value) {
 }
 
 // Search for a value in the list
-template <typename T>
-bool List<T>::search(T value) const {
+template <typename T, typename Allocator>
+bool List<T, Allocator>::search(T value) const {
     Node<T>* current = head;
     while (current) {
         if (current->value == value) {
@@ -161,94 +111,61 @@ bool List<T>::search(T value) const {
 }
 
 // Clear the list
-template <typename T>
-void List<T>::clear() {
-    while (head) {
-        Node<T>* temp = head;
-        head = head->next;
-        delete temp;
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() {
+    // Pooled nodes of trivially destructible types need no per-node work
+    if (!(Allocator::bulkRelease && std::is_trivially_destructible<T>::value)) {
+        while (head) {
+            Node<T>* temp = head;
+            head = head->next;
+            allocator.destroy(temp);
+        }
     }
+    allocator.releaseAll();
     head = tail = nullptr;
     size = 0;
 }
 
-// Generate a list with random values
-template <typename T>
-void List<T>::generateList(int size) {
+// Generate a list with random values; same seed, same values as Vector::generateRandom
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateList(int size) {
     clear();
-    RandomGenerator rng;
-    
-    for (int i = 0; i < size; ++i) {
-        // Generate appropriate random value based on type T
-        if (std::is_same<T, int>::value) {
-            insertAtTail(static_cast<T>(rng.getInt()));
-        }
-        else if (std::is_same<T, float>::value) {
-            insertAtTail(static_cast<T>(rng.getFloat()));
-        }
-        else if (std::is_same<T, double>::value) {
-            insertAtTail(static_cast<T>(rng.getDouble()));
-        }
-        else if (std::is_same<T, char>::value) {
-            insertAtTail(static_cast<T>(rng.getChar()));
-        }
-        else {
-            // Default case - just insert zeros if type not handled
-            insertAtTail(static_cast<T>(0));
-        }
-    }
+    generateRandomPortion(size, 0);
 }
 
-template <typename T>
-void List<T>::generateSortedPortion(int /*size*/, int start, int end) {
-    if (std::is_same<T, char>::value) {
-        int maxChars = std::min(end - start, 26);  // Only allow up to 'z'
-        char startChar = 'a';
-
-        for (int i = 0; i < maxChars; ++i) {
-            char currentChar = static_cast<char>(startChar + i);
-            insertAtTail(currentChar);
-        }
+template <typename T, typename Allocator>
+T List<T, Allocator>::fromKey(long long key, long long keyCount) {
+    if constexpr (std::is_same<T, char>::value) {
+        return static_cast<char>('a' + (keyCount > 1 ? key * 26 / keyCount : 0));
+    } else {
+        return static_cast<T>(key);
+    }
+}
 
-        // If more sorted chars are requested beyond 'z', fill with 'z'
-        for (int i = maxChars + start; i < end; ++i) {
-            insertAtTail('z');
-        }
-    } 
-    else if (std::is_arithmetic<T>::value) {
-        for (int i = start; i < end; i++) {
-            insertAtTail(static_cast<T>(i));
-        }
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateSortedPortion(int /*size*/, int start, int end) {
+    for (int i = start; i < end; i++) {
+        insertAtTail(fromKey(i, end));
     }
 }
 
 // Helper function to generate the random portion of the list
-template <typename T>
-void List<T>::generateRandomPortion(int size, int start) {
-    RandomGenerator rng;
-    for (int i = start; i < size; i++) {
-        // Generate appropriate random value based on type T
-        if (std::is_same<T, int>::value) {
-            insertAtTail(static_cast<T>(rng.getInt()));
-        }
-        else if (std::is_same<T, float>::value) {
-            insertAtTail(static_cast<T>(rng.getFloat()));
-        }
-        else if (std::is_same<T, double>::value) {
-            insertAtTail(static_cast<T>(rng.getFloat()));
-        }
-        else if (std::is_same<T, char>::value) {
-            insertAtTail(static_cast<T>(rng.getChar()));
-        }
-        else {
-            insertAtTail(static_cast<T>(0));  // Default case for unsupported types
-        }
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateRandomPortion(int size, int start) {
+    if (size <= start)
+        return;
+
+    // Drawn into a flat buffer first so the values follow RandomGenerator::fill's block layout
+    std::vector<T> values(size - start);
+    RandomGenerator::forDataset().fill(values.data(), size - start, 0);
+    for (const T& value : values) {
+        insertAtTail(value);
     }
 }
 
 // Generate the first 33% of the list in sorted order, the rest in random order
-template <typename T>
-void List<T>::generateListSorted33(int size) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateListSorted33(int size) {
     clear();
 
     int firstPartSize = static_cast<int>(size * 0.33);  // First 33% sorted
@@ -261,8 +178,8 @@ void List<T>::generateListSorted33(int size) {
 }
 
 // Generate the first 66% of the list in sorted order, the rest in random order
-template <typename T>
-void List<T>::generateListSorted66(int size) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateListSorted66(int size) {
     clear();
 
     int firstPartSize = static_cast<int>(size * 0.66);  // First 66% sorted
@@ -275,161 +192,192 @@ void List<T>::generateListSorted66(int size) {
 }
 
 // Sort the list
-template <typename T>
-void List<T>::sortList() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::sortList() {
     if (size <= 1) return; // Already sorted or empty
     
     // Create a vector of values
-    std::vector<T> values;
-    Node<T>* current = head;
-    
-    while (current) {
-        values.push_back(current->value);
-        current = current->next;
-    }
+    std::vector<T> values(cbegin(), cend());
     
     // Sort the vector
     std::sort(values.begin(), values.end());
     
-    // Update the list with sorted values
-    current = head;
-    for (const T& val : values) {
-        current->value = val;
-        current = current->next;
-    }
+    // Update the list with sorted values in place
+    std::copy(values.begin(), values.end(), begin());
 }
 
-// Get a copy of the list
-template <typename T>
-Node<T>* List<T>::getList() {
-    Node<T>* newHead = nullptr;
-    Node<T>* newTail = nullptr;
+// Get the head of the list. The nodes are the list's own, not a copy:
+// callers must not free them and must not outlive the list.
+template <typename T, typename Allocator>
+Node<T>* List<T, Allocator>::getList() {
+    return head;
+}
 
-    // Create a new copy
-    Node<T>* current = head;
-    while (current) {
-        Node<T>* newNode = new Node<T>(current->value);
-        
-        if (!newHead) {
-            newHead = newTail = newNode;
-        } else {
-            newTail->next = newNode;
-            newNode->previous = newTail;
-            newTail = newNode;
-        }
-        
-        current = current->next;
-    }
+template <typename T, typename Allocator>
+const Node<T>* List<T, Allocator>::getList() const {
+    return head;
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
+    return iterator(head, tail);
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::end() {
+    return iterator(nullptr, tail);
+}
 
-    return newHead;
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::begin() const {
+    return const_iterator(head, tail);
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::end() const {
+    return const_iterator(nullptr, tail);
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::cbegin() const {
+    return begin();
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::cend() const {
+    return end();
+}
+
+// Range over all nodes, usable in range-based for loops
+template <typename T, typename Allocator>
+ListRange<typename List<T, Allocator>::iterator> List<T, Allocator>::view() {
+    return ListRange<iterator>(begin(), end(), size);
+}
+
+template <typename T, typename Allocator>
+ListRange<typename List<T, Allocator>::const_iterator> List<T, Allocator>::view() const {
+    return ListRange<const_iterator>(begin(), end(), size);
 }
 
 // Get the size of the list
-template <typename T>
-int List<T>::getSize() const {
+template <typename T, typename Allocator>
+int List<T, Allocator>::getSize() const {
     return size;
 }
 
 // Print the list contents
-template <typename T>
-void List<T>::printList() const {
-    Node<T>* current = head;
-    while (current) {
-        std::cout << current->value << " ";
-        current = current->next;
+template <typename T, typename Allocator>
+void List<T, Allocator>::printList() const {
+    for (const T& value : view()) {
+        std::cout << value << " ";
     }
     std::cout << std::endl;
 }
 
 // Generate a list with values in descending order
-template <typename T>
-void List<T>::generateListDescending(int size) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateListDescending(int size) {
     clear();
-    // For numeric types
-    if (std::is_arithmetic<T>::value) {
-        for (int i = size - 1; i >= 0; i--) {
-            insertAtTail(static_cast<T>(i));
-        }
-    }
-    // For char type
-    else if (std::is_same<T, char>::value) {
-        char startChar = 'a' + size - 1;
-        for (int i = 0; i < size; i++) {
-            insertAtTail(static_cast<T>(startChar - i));
-        }
+    for (int i = size - 1; i >= 0; i--) {
+        insertAtTail(fromKey(i, size));
     }
 }
 
 // Generate a list with values in ascending order
-template <typename T>
-void List<T>::generateListAscending(int size) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::generateListAscending(int size) {
     clear();
-    // For numeric types
-    if (std::is_arithmetic<T>::value) {
-        for (int i = 0; i < size; i++) {
-            insertAtTail(static_cast<T>(i));
-        }
+    for (int i = 0; i < size; i++) {
+        insertAtTail(fromKey(i, size));
     }
-    // For char type
-    else if (std::is_same<T, char>::value) {
-        char startChar = 'a';
-        for (int i = 0; i < size; i++) {
-            insertAtTail(static_cast<T>(startChar + i));
-        }
+}
+
+// Load a binary dataset (see DataFile/BinaryFormat.h) straight from a memory map
+template <typename T, typename Allocator>
+int List<T, Allocator>::loadFromBinaryFile(const std::string& filename) {
+    static_assert(BinaryFormat::typeTag<T>() != 0, "Binary files hold int, float, double or char");
+    clear();
+
+    MappedFile file;
+    if (file.open(filename) != 0) {
+        return -1;
+    }
+    if (file.getSize() < sizeof(BinaryHeader)) {
+        std::cerr << "Binary file is too short for its header.\n";
+        return -1;
+    }
+
+    BinaryHeader header;
+    std::memcpy(&header, file.getData(), sizeof(header));
+
+    uint64_t count = 0;
+    if (BinaryFormat::validate(header, BinaryFormat::typeTag<T>(), sizeof(T), file.getSize(), count) != 0) {
+        return -1;
+    }
+
+    bool swap = (header.littleEndian != 0) != BinaryFormat::hostIsLittleEndian();
+    const unsigned char* payload = file.getData() + sizeof(header);
+    for (uint64_t i = 0; i < count; ++i) {
+        T value;
+        std::memcpy(&value, payload + i * sizeof(T), sizeof(T));
+        if (swap) BinaryFormat::swapBytes(&value, sizeof(T), 1);
+        insertAtTail(value);
     }
+    return 0;
 }
 
 // Save list data to a file
-template <typename T>
-void List<T>::saveToFile(const std::string& filename) const {
-    FILE* file = fopen(filename.c_str(), "w");
-    if (file == nullptr) {
-        std::cerr << "Could not open file for writing: " << filename << std::endl;
+template <typename T, typename Allocator>
+void List<T, Allocator>::saveToFile(const std::string& filename) const {
+    TextWriter<T> writer;
+    if (writer.open(filename) != 0) {
         return;
     }
 
-    fprintf(file, "%d\n", size);  // Write the number of elements
+    writer.writeHeader(size);
+    for (const T& value : view()) {
+        writer.append(value);
+    }
+    writer.close();
+}
 
-    Node<T>* current = head;
-    while (current) {
-        if (std::is_same<T, int>::value) {
-            fprintf(file, "%d\n", static_cast<int>(current->value));
-        }
-        else if (std::is_same<T, float>::value) {
-            fprintf(file, "%f\n", static_cast<float>(current->value));
-        }
-        else if (std::is_same<T, double>::value) {
-            fprintf(file, "%lf\n", static_cast<double>(current->value));
-        }
-        else if (std::is_same<T, char>::value) {
-            fprintf(file, "%c\n", static_cast<char>(current->value));
-        }
-        else {
-            std::cerr << "Unsupported type for saving.\n";
-            fclose(file);
-            return;
-        }
+// Header plus the node values in host byte order
+template <typename T, typename Allocator>
+int List<T, Allocator>::saveToBinaryFile(const std::string& filename) const {
+    static_assert(BinaryFormat::typeTag<T>() != 0, "Binary files hold int, float, double or char");
 
-        current = current->next;
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "Could not open file for writing: " << filename << std::endl;
+        return -1;
     }
 
-    fclose(file);
+    BinaryHeader header = BinaryFormat::makeHeader(BinaryFormat::typeTag<T>(), sizeof(T), static_cast<uint64_t>(size));
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const T& value : view()) {
+        written = written && fwrite(&value, sizeof(T), 1, file) == 1;
+    }
+
+    if (fclose(file) != 0 || !written) {
+        std::cerr << "Error writing binary file: " << filename << std::endl;
+        return -1;
+    }
+    return 0;
 }
 
-template <typename T>
-int List<T>::checkSortedList() const {
+template <typename T, typename Allocator>
+int List<T, Allocator>::checkSortedList() const {
     if (!head || !head->next) {
         std::cout << "List is empty or contains a single element.\n";
         return 100;  // 100% sorted if 0 or 1 element
     }
 
     int correctCount = 1;
-    Node<T>* current = head;
+    const_iterator previous = begin();
 
-    while (current->next) {
-        if (current->value <= current->next->value) {
+    for (const_iterator it = std::next(previous); it != end(); previous = it++) {
+        if (*previous <= *it) {
             correctCount++;
-            current = current->next;
         } else {
             break;
         }
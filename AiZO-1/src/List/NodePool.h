@@ -0,0 +1,63 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <vector>
+
+template <typename T>
+class Node;
+
+// Slab allocator for list nodes. Nodes are carved out of large slabs,
+// freed nodes are recycled through an intrusive free list and every slab
+// is released at once by releaseAll().
+template <typename T>
+class NodePool {
+public:
+    // Whether releaseAll() frees every node without walking the list
+    static constexpr bool bulkRelease = true;
+
+    explicit NodePool(int firstSlabNodes = 256, int maxSlabNodes = 65536);
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    Node<T>* create(const T& value);
+    void destroy(Node<T>* node);
+    void releaseAll();
+
+    // Statistics
+    int getSlabCount() const;
+    long long getReservedBytes() const;
+
+private:
+    // Header placed in a destroyed node's storage to link it into the free list
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    std::vector<Node<T>*> slabs;
+    FreeSlot* freeList;  // Recycled node slots, no live Node<T> in them
+    Node<T>* cursor;     // Next untouched node in the newest slab
+    Node<T>* slabEnd;
+    int firstSlabNodes;
+    int maxSlabNodes;
+    int nextSlabNodes;
+    long long reservedBytes;
+
+    void addSlab();
+};
+
+// Plain new/delete per node - the allocator List<T> used before NodePool
+template <typename T>
+class HeapNodeAllocator {
+public:
+    static constexpr bool bulkRelease = false;
+
+    Node<T>* create(const T& value);
+    void destroy(Node<T>* node);
+    void releaseAll() {}
+};
+
+#include "NodePool.tpp"
+
+#endif // NODE_POOL_H
@@ -0,0 +1,97 @@
+#include <new>
+#include <algorithm>
+
+// Constructor
+template <typename T>
+NodePool<T>::NodePool(int firstSlabNodes, int maxSlabNodes)
+    : freeList(nullptr),
+      cursor(nullptr),
+      slabEnd(nullptr),
+      firstSlabNodes(std::max(1, firstSlabNodes)),
+      maxSlabNodes(std::max(firstSlabNodes, maxSlabNodes)),
+      nextSlabNodes(std::max(1, firstSlabNodes)),
+      reservedBytes(0) {}
+
+// Destructor
+template <typename T>
+NodePool<T>::~NodePool() {
+    releaseAll();
+}
+
+// Allocate a new slab, doubling the slab size up to maxSlabNodes
+template <typename T>
+void NodePool<T>::addSlab() {
+    std::size_t bytes = static_cast<std::size_t>(nextSlabNodes) * sizeof(Node<T>);
+    Node<T>* slab = static_cast<Node<T>*>(::operator new(bytes));
+
+    slabs.push_back(slab);
+    cursor = slab;
+    slabEnd = slab + nextSlabNodes;
+    reservedBytes += static_cast<long long>(bytes);
+
+    nextSlabNodes = std::min(nextSlabNodes * 2, maxSlabNodes);
+}
+
+// Construct a node, preferring recycled slots over fresh slab space
+template <typename T>
+Node<T>* NodePool<T>::create(const T& value) {
+    void* slot;
+
+    if (freeList) {
+        slot = freeList;
+        freeList = freeList->next;
+    } else {
+        if (cursor == slabEnd) {
+            addSlab();
+        }
+        slot = cursor++;
+    }
+
+    return new (slot) Node<T>(value);
+}
+
+// Destroy a single node and put its slot on the free list
+template <typename T>
+void NodePool<T>::destroy(Node<T>* node) {
+    static_assert(sizeof(FreeSlot) <= sizeof(Node<T>) && alignof(FreeSlot) <= alignof(Node<T>),
+                  "a free list header must fit in a node slot");
+
+    // The node is dead after its destructor, so the link lives in a fresh header
+    node->~Node<T>();
+    freeList = new (static_cast<void*>(node)) FreeSlot{freeList};
+}
+
+// Free every slab at once. Live nodes must already be destroyed unless
+// T is trivially destructible.
+template <typename T>
+void NodePool<T>::releaseAll() {
+    for (Node<T>* slab : slabs) {
+        ::operator delete(slab);
+    }
+
+    slabs.clear();
+    freeList = nullptr;
+    cursor = slabEnd = nullptr;
+    nextSlabNodes = firstSlabNodes;
+    reservedBytes = 0;
+}
+
+template <typename T>
+int NodePool<T>::getSlabCount() const {
+    return static_cast<int>(slabs.size());
+}
+
+template <typename T>
+long long NodePool<T>::getReservedBytes() const {
+    return reservedBytes;
+}
+
+template <typename T>
+Node<T>* HeapNodeAllocator<T>::create(const T& value) {
+    return new Node<T>(value);
+}
+
+template <typename T>
+void HeapNodeAllocator<T>::destroy(Node<T>* node) {
+    delete node;
+}
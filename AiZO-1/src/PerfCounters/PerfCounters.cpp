@@ -0,0 +1,203 @@
+#include "PerfCounters.h"
+
+#include <cerrno>
+#include <cstring>
+#include <cstdio>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+struct EventConfig {
+    unsigned int type;
+    unsigned long long config;
+};
+
+constexpr unsigned long long cacheMiss(unsigned long long cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+// Indexed by Counter
+const EventConfig events[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},  // last-level cache
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_DTLB)},
+};
+
+int openEvent(const EventConfig& event) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.inherit = 1;         // count the sort's worker threads too
+    attr.exclude_kernel = 1;  // allowed at perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+}  // namespace
+
+PerfCounters::PerfCounters() : openError(0) {
+    for (int i = 0; i < counterCount; ++i) {
+        descriptors[i] = -1;
+        values[i] = -1;
+#ifdef __linux__
+        descriptors[i] = openEvent(events[i]);
+        if (descriptors[i] < 0 && openError == 0) {
+            openError = errno;
+        }
+#endif
+    }
+#ifndef __linux__
+    openError = ENOSYS;
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int i = 0; i < counterCount; ++i) {
+        if (descriptors[i] >= 0) {
+            close(descriptors[i]);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::isAvailable() const {
+    for (int i = 0; i < counterCount; ++i) {
+        if (descriptors[i] >= 0) return true;
+    }
+    return false;
+}
+
+bool PerfCounters::isAvailable(Counter counter) const {
+    return descriptors[static_cast<int>(counter)] >= 0;
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    for (int i = 0; i < counterCount; ++i) {
+        values[i] = -1;
+        if (descriptors[i] >= 0) {
+            ioctl(descriptors[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptors[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+void PerfCounters::stop() {
+#ifdef __linux__
+    for (int i = 0; i < counterCount; ++i) {
+        if (descriptors[i] >= 0) {
+            ioctl(descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (int i = 0; i < counterCount; ++i) {
+        if (descriptors[i] < 0) continue;
+
+        // value, time enabled, time running
+        unsigned long long data[3];
+        if (read(descriptors[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+            values[i] = -1;
+            continue;
+        }
+
+        double scale = data[2] < data[1] ? static_cast<double>(data[1]) / data[2] : 1.0;
+        values[i] = static_cast<long long>(data[0] * scale);
+    }
+#endif
+}
+
+long long PerfCounters::getValue(Counter counter) const {
+    return values[static_cast<int>(counter)];
+}
+
+double PerfCounters::getIpc() const {
+    long long cycles = getValue(Counter::Cycles);
+    long long instructions = getValue(Counter::Instructions);
+    if (cycles <= 0 || instructions < 0) {
+        return -1.0;
+    }
+    return static_cast<double>(instructions) / cycles;
+}
+
+void PerfCounters::print(std::ostream& out) const {
+    if (!isAvailable()) {
+        out << "Hardware counters unavailable: ";
+        if (openError == ENOENT || openError == EOPNOTSUPP) {
+            out << "no PMU exposed to this machine (VM or container?)\n";
+        } else if (openError == EACCES || openError == EPERM) {
+            out << "not permitted, lower /proc/sys/kernel/perf_event_paranoid\n";
+        } else {
+            out << std::strerror(openError) << '\n';
+        }
+        return;
+    }
+
+    out << "Counters:";
+    const char* separator = " ";
+    for (int i = 0; i < counterCount; ++i) {
+        if (values[i] < 0) continue;
+        out << separator << counterName(static_cast<Counter>(i)) << ' ' << values[i];
+        separator = " | ";
+    }
+    if (getIpc() >= 0) {
+        char ipc[32];
+        std::snprintf(ipc, sizeof(ipc), "%.2f", getIpc());
+        out << separator << "IPC " << ipc;
+    }
+    out << '\n';
+}
+
+std::string PerfCounters::csvValues() const {
+    std::string row;
+    for (int i = 0; i < counterCount; ++i) {
+        if (i > 0) row += ';';
+        if (values[i] >= 0) row += std::to_string(values[i]);
+    }
+
+    row += ';';
+    if (getIpc() >= 0) {
+        char ipc[32];
+        std::snprintf(ipc, sizeof(ipc), "%.4f", getIpc());
+        row += ipc;
+    }
+    return row;
+}
+
+std::string PerfCounters::csvHeader() {
+    std::string header;
+    for (int i = 0; i < counterCount; ++i) {
+        if (i > 0) header += ';';
+        header += counterName(static_cast<Counter>(i));
+    }
+    return header + ";ipc";
+}
+
+const char* PerfCounters::counterName(Counter counter) {
+    switch (counter) {
+        case Counter::Cycles: return "cycles";
+        case Counter::Instructions: return "instructions";
+        case Counter::L1dMisses: return "l1d_misses";
+        case Counter::LlcMisses: return "llc_misses";
+        case Counter::BranchMisses: return "branch_misses";
+        case Counter::TlbMisses: return "dtlb_misses";
+        default: return "unknown";
+    }
+}
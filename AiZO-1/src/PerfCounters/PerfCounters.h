@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+// Hardware events recorded around a measured region
+enum class Counter { Cycles, Instructions, L1dMisses, LlcMisses, BranchMisses, TlbMisses, Count };
+
+// Linux perf_event_open counters for the calling thread and the threads it
+// starts while counting. Each event is opened on its own, so a CPU or VM that
+// only exposes some of them still reports those; events that cannot be
+// opened (no PMU, perf_event_paranoid, non-Linux build) read as -1.
+// Values are scaled when the kernel had to multiplex the counters.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool isAvailable() const;  // at least one event opened
+    bool isAvailable(Counter counter) const;
+
+    void start();  // reset and enable
+    void stop();   // disable and read
+
+    long long getValue(Counter counter) const;  // -1 when unavailable
+    double getIpc() const;                      // -1 without cycles and instructions
+
+    // "cycles 123 | instructions 456 | IPC 3.71 | ..." or the reason nothing was counted
+    void print(std::ostream& out) const;
+
+    // ';'-separated values in counterName() order plus IPC; empty fields when unavailable
+    std::string csvValues() const;
+    static std::string csvHeader();
+
+    static const char* counterName(Counter counter);
+
+private:
+    static constexpr int counterCount = static_cast<int>(Counter::Count);
+
+    int descriptors[counterCount];
+    long long values[counterCount];
+    int openError;  // errno of the first failed open, for print()
+};
@@ -0,0 +1,32 @@
+#include "BernoulliStream.h"
+#include <cmath>
+
+namespace {
+
+constexpr long long never = std::numeric_limits<long long>::max();
+
+}  // namespace
+
+BernoulliStream::BernoulliStream(long long numerator, long long denominator, RandomGenerator& rng)
+    : probability(0.0), logComplement(0.0), untilTrue(never) {
+    if (denominator <= 0 || numerator <= 0) {
+        return;
+    }
+
+    probability = numerator >= denominator ? 1.0 : static_cast<double>(numerator) / static_cast<double>(denominator);
+    logComplement = std::log1p(-probability);
+    untilTrue = distance(rng);
+}
+
+// P(distance = k) = (1 - p)^(k-1) p for k >= 1: the first k with
+// (1 - p)^k < u for u uniform in (0, 1]
+long long BernoulliStream::distance(RandomGenerator& rng) const {
+    if (probability <= 0.0)
+        return never;
+    if (probability >= 1.0)
+        return 1;
+
+    double u = 1.0 - rng.getUnit();
+    double trials = std::floor(std::log(u) / logComplement);
+    return trials < static_cast<double>(never - 1) ? static_cast<long long>(trials) + 1 : never;
+}
@@ -0,0 +1,33 @@
+#ifndef BERNOULLI_STREAM_H
+#define BERNOULLI_STREAM_H
+
+#include "RandomGenerator.h"
+
+// Stream of independent decisions that are true with probability
+// numerator / denominator. The bitstream is kept run-length encoded: only
+// the distance to the next true decision is drawn (geometric, by inversion),
+// so a false decision costs a decrement and a true one a draw and a log.
+// With rare faults that is far below one random value per decision.
+class BernoulliStream {
+public:
+    // Draws the first distance from rng; pass the same rng to next()
+    BernoulliStream(long long numerator, long long denominator, RandomGenerator& rng);
+
+    bool next(RandomGenerator& rng) {
+        if (--untilTrue > 0)
+            return false;
+        untilTrue = distance(rng);
+        return true;
+    }
+
+    double getProbability() const { return probability; }
+
+private:
+    double probability;
+    double logComplement;  // log(1 - probability)
+    long long untilTrue;   // decisions until the next true one, this one included
+
+    long long distance(RandomGenerator& rng) const;
+};
+
+#endif // BERNOULLI_STREAM_H
@@ -1,39 +1,83 @@
 #include "RandomGenerator.h"
-#include <limits>
+#include <atomic>
+#include <mutex>
+#include <random>
 
-// Constructor
-RandomGenerator::RandomGenerator() : gen(rd()) {
+namespace {
+
+std::once_flag seedOnce;
+uint64_t processSeed = 0;
+
+std::atomic<uint64_t> nextSorterStream(0);
+std::atomic<uint64_t> nextDatasetStream(0);
+
+// Stream numbers of the two families never collide
+constexpr uint64_t datasetStreamBit = 1ULL << 63;
+
+uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
 }
 
-// Generate a random integer in the full range of int
-int RandomGenerator::getInt() {
-    std::uniform_int_distribution<int> distrib(
-        std::numeric_limits<int>::min(),
-        std::numeric_limits<int>::max()
-    );
-    return distrib(gen);
+}  // namespace
+
+// Expand (seed, stream) into the 256-bit state; SplitMix64 never yields all zeros here
+void RandomGenerator::seedFrom(uint64_t seed, uint64_t stream) {
+    uint64_t mix = stream;
+    uint64_t x = seed ^ splitMix64(mix);
+    for (uint64_t& word : state) {
+        word = splitMix64(x);
+    }
 }
 
-// Generate a random char in the range a-z
-char RandomGenerator::getChar() {
-    std::uniform_int_distribution<int> distrib('a', 'z');
-    return static_cast<char>(distrib(gen));
+RandomGenerator::RandomGenerator() {
+    seedFrom(getSeed(), nextSorterStream++);
 }
 
-// Generate a random float in the full float range
-float RandomGenerator::getFloat() {
-    std::uniform_real_distribution<float> distrib(-1e38, 1e38);
+RandomGenerator::RandomGenerator(uint64_t seed) {
+    seedFrom(seed, 0);
+}
 
-    return distrib(gen);
+RandomGenerator RandomGenerator::forDataset() {
+    RandomGenerator rng(0);
+    rng.seedFrom(getSeed(), datasetStreamBit | nextDatasetStream++);
+    return rng;
 }
 
-// Generate a random double in the full double range
-double RandomGenerator::getDouble() {
-    std::uniform_real_distribution<double> distrib(-1e156, 1e156);
-    return distrib(gen);
+void RandomGenerator::setSeed(uint64_t seed) {
+    std::call_once(seedOnce, [] {});
+    processSeed = seed;
+    nextSorterStream = 0;
+    nextDatasetStream = 0;
 }
 
-// Get access to the underlying generator
-std::mt19937& RandomGenerator::getGenerator() {
-    return gen;
-}
\ No newline at end of file
+uint64_t RandomGenerator::getSeed() {
+    std::call_once(seedOnce, [] {
+        std::random_device rd;
+        processSeed = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    });
+    return processSeed;
+}
+
+void RandomGenerator::jump() {
+    static const uint64_t polynomial[] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                          0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+
+    uint64_t jumped[4] = {0, 0, 0, 0};
+    for (uint64_t word : polynomial) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if (word & (1ULL << bit)) {
+                for (int i = 0; i < 4; ++i) {
+                    jumped[i] ^= state[i];
+                }
+            }
+            next();
+        }
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        state[i] = jumped[i];
+    }
+}
@@ -1,31 +1,86 @@
 #ifndef RANDOM_GENERATOR_H
 #define RANDOM_GENERATOR_H
 
-#include <random>
 #include <cstdint>
+#include <limits>
 
+// xoshiro256** (Blackman & Vigna): 256 bits of state, a few ns per value,
+// and a jump() that advances the stream by 2^128 values so independent
+// streams can be carved out of one seed.
+//
+// Every generator is derived from one process-wide seed (--seed, otherwise
+// drawn from std::random_device on first use), so a run with the same seed
+// and the same command line reproduces the same data.
 class RandomGenerator {
 private:
-    std::random_device rd;
-    std::mt19937 gen;
+    uint64_t state[4];
+
+    void seedFrom(uint64_t seed, uint64_t stream);
 
 public:
+    // Next stream of the process seed, for sorter-internal randomness
     RandomGenerator();
-    
+
+    // A stream of its own, independent of the process seed
+    explicit RandomGenerator(uint64_t seed);
+
+    // The next dataset stream of the process seed. Dataset streams are
+    // numbered separately from the sorter streams, so pivots and drunk
+    // comparisons never shift the data of later runs.
+    static RandomGenerator forDataset();
+
+    static void setSeed(uint64_t seed);
+    static uint64_t getSeed();
+
+    // Raw 64 random bits
+    uint64_t next();
+
+    // Advance by 2^128 values
+    void jump();
+
+    // Uniform double in [0, 1) with 53 random bits
+    double getUnit();
+
+    // Uniform integer in [0, bound), bound < 2^32
+    uint32_t getBelow(uint32_t bound);
+
     // Generate a random integer in the full range of int
     int getInt();
-    
-    // Generate a random char in the full range (0-255)
+
+    // Generate a random char in the range a-z
     char getChar();
-    
+
     // Generate a random float in the full float range
     float getFloat();
-    
+
     // Generate a random double in the full double range
     double getDouble();
-    
-    // Get access to the underlying generator
-    std::mt19937& getGenerator();
+
+    // getInt/getFloat/getDouble/getChar by type, 0 for anything else
+    template <typename T>
+    T getValue();
+
+    // Call generate(stream, begin, end) for consecutive blocks of blockSize
+    // indices covering [0, count). Block b gets this generator's stream
+    // jumped b times, so whatever generate() draws is the same for every
+    // thread count (0 = all hardware threads). Afterwards this generator
+    // is past every stream it handed out.
+    template <typename Generate>
+    void forEachBlock(long long count, int threads, Generate generate);
+
+    // Fill out[0..count) with getValue<T>() through forEachBlock
+    template <typename T>
+    void fill(T* out, long long count, int threads = 1);
+
+    static constexpr long long blockSize = 1 << 16;
+
+    // UniformRandomBitGenerator, for use with <random> distributions
+    using result_type = uint64_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+    result_type operator()() { return next(); }
 };
 
-#endif // RANDOM_GENERATOR_H
\ No newline at end of file
+#include "RandomGenerator.tpp"
+
+#endif // RANDOM_GENERATOR_H
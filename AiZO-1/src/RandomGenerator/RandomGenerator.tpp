@@ -0,0 +1,106 @@
+#include <type_traits>
+#include "../ThreadPool/ThreadPool.h"
+
+inline uint64_t RandomGenerator::next() {
+    const uint64_t result = ((state[1] * 5) << 7 | (state[1] * 5) >> 57) * 9;
+    const uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = state[3] << 45 | state[3] >> 19;
+
+    return result;
+}
+
+inline double RandomGenerator::getUnit() {
+    return static_cast<double>(next() >> 11) * 0x1.0p-53;
+}
+
+// Lemire's multiply-shift maps 32 random bits onto [0, bound) without a division
+inline uint32_t RandomGenerator::getBelow(uint32_t bound) {
+    return static_cast<uint32_t>(((next() >> 32) * bound) >> 32);
+}
+
+inline int RandomGenerator::getInt() {
+    return static_cast<int>(static_cast<uint32_t>(next() >> 32));
+}
+
+inline char RandomGenerator::getChar() {
+    return static_cast<char>('a' + getBelow(26));
+}
+
+inline float RandomGenerator::getFloat() {
+    return static_cast<float>(-1e38 + getUnit() * 2e38);
+}
+
+inline double RandomGenerator::getDouble() {
+    return -1e156 + getUnit() * 2e156;
+}
+
+template <typename T>
+T RandomGenerator::getValue() {
+    if constexpr (std::is_same<T, int>::value) {
+        return getInt();
+    } else if constexpr (std::is_same<T, float>::value) {
+        return getFloat();
+    } else if constexpr (std::is_same<T, double>::value) {
+        return getDouble();
+    } else if constexpr (std::is_same<T, char>::value) {
+        return getChar();
+    } else {
+        return static_cast<T>(0);
+    }
+}
+
+template <typename Generate>
+void RandomGenerator::forEachBlock(long long count, int threads, Generate generate) {
+    long long blocks = (count + blockSize - 1) / blockSize;
+    if (threads <= 0) {
+        threads = ThreadPool::hardwareThreads();
+    }
+    if (threads > blocks) {
+        threads = static_cast<int>(blocks);
+    }
+
+    // Blocks [first, last) from 'stream', which starts at block 'first'
+    auto runBlocks = [&generate, count](RandomGenerator stream, long long first, long long last) {
+        for (long long b = first; b < last; ++b) {
+            RandomGenerator block = stream;
+            long long end = (b + 1) * blockSize < count ? (b + 1) * blockSize : count;
+            generate(block, b * blockSize, end);
+            stream.jump();
+        }
+    };
+
+    if (threads <= 1) {
+        runBlocks(*this, 0, blocks);
+    } else {
+        ThreadPool pool(threads);
+        RandomGenerator stream = *this;
+        for (int t = 0; t < threads; ++t) {
+            long long first = blocks * t / threads;
+            long long last = blocks * (t + 1) / threads;
+            pool.submit([&runBlocks, stream, first, last] { runBlocks(stream, first, last); });
+            for (long long b = first; b < last; ++b) {
+                stream.jump();
+            }
+        }
+        pool.waitIdle();
+    }
+
+    for (long long b = 0; b < blocks; ++b) {
+        jump();
+    }
+}
+
+template <typename T>
+void RandomGenerator::fill(T* out, long long count, int threads) {
+    forEachBlock(count, threads, [out](RandomGenerator& rng, long long begin, long long end) {
+        for (long long i = begin; i < end; ++i) {
+            out[i] = rng.template getValue<T>();
+        }
+    });
+}
@@ -0,0 +1,63 @@
+#include "ZipfSampler.h"
+#include <cmath>
+
+namespace {
+
+// log(1 + x) / x, accurate near 0
+double log1pOverX(double x) {
+    if (std::fabs(x) > 1e-8) {
+        return std::log1p(x) / x;
+    }
+    return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+// (exp(x) - 1) / x, accurate near 0
+double expm1OverX(double x) {
+    if (std::fabs(x) > 1e-8) {
+        return std::expm1(x) / x;
+    }
+    return 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+}
+
+}  // namespace
+
+ZipfSampler::ZipfSampler(long long n, double exponent) : n(n < 1 ? 1 : n), exponent(exponent) {
+    hIntegralX1 = hIntegral(1.5) - 1.0;
+    hIntegralN = hIntegral(static_cast<double>(this->n) + 0.5);
+    squeeze = 2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0));
+}
+
+double ZipfSampler::h(double x) const {
+    return std::exp(-exponent * std::log(x));
+}
+
+double ZipfSampler::hIntegral(double x) const {
+    double logX = std::log(x);
+    return expm1OverX((1.0 - exponent) * logX) * logX;
+}
+
+double ZipfSampler::hIntegralInverse(double x) const {
+    double t = x * (1.0 - exponent);
+    if (t < -1.0) {
+        t = -1.0;  // Rounding guard, the exact value is never below -1
+    }
+    return std::exp(log1pOverX(t) * x);
+}
+
+long long ZipfSampler::sample(RandomGenerator& rng) const {
+    while (true) {
+        double u = hIntegralN + rng.getUnit() * (hIntegralX1 - hIntegralN);
+        double x = hIntegralInverse(u);
+
+        long long k = static_cast<long long>(x + 0.5);
+        if (k < 1) {
+            k = 1;
+        } else if (k > n) {
+            k = n;
+        }
+
+        if (k - x <= squeeze || u >= hIntegral(k + 0.5) - h(static_cast<double>(k))) {
+            return k;
+        }
+    }
+}
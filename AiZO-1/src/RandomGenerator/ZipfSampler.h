@@ -0,0 +1,28 @@
+#ifndef ZIPF_SAMPLER_H
+#define ZIPF_SAMPLER_H
+
+#include "RandomGenerator.h"
+
+// Zipf distribution over ranks 1..n: P(k) is proportional to 1 / k^exponent.
+// Rejection-inversion sampling (Hoermann & Derflinger, 1996) needs no table
+// and O(1) expected draws per value for any n. sample() does not modify the
+// sampler, so one sampler can be shared by threads with their own streams.
+class ZipfSampler {
+public:
+    ZipfSampler(long long n, double exponent);
+
+    long long sample(RandomGenerator& rng) const;
+
+private:
+    long long n;
+    double exponent;
+    double hIntegralX1;
+    double hIntegralN;
+    double squeeze;
+
+    double h(double x) const;
+    double hIntegral(double x) const;
+    double hIntegralInverse(double x) const;
+};
+
+#endif // ZIPF_SAMPLER_H
@@ -0,0 +1,30 @@
+#ifndef COUNTINGSORT_H
+#define COUNTINGSORT_H
+
+#include <type_traits>
+#include "../../List/List.h"
+#include "../../Vector/Vector.h"
+
+// Counting sort for 8-bit integral types (char, signed/unsigned char):
+// one pass to count the 256 possible keys, one pass to write them back
+template <typename T>
+class CountingSort {
+    static_assert(std::is_integral<T>::value && sizeof(T) == 1,
+                  "CountingSort is only defined for 8-bit integral types");
+
+public:
+    CountingSort() {}
+    ~CountingSort() {}
+
+    void sort(List<T>& list);
+    void sort(Vector<T>& values);
+};
+
+// Types that other sorters hand over to CountingSort automatically
+template <typename T>
+struct UsesCountingSort
+    : std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) == 1> {};
+
+#include "CountingSort.tpp"
+
+#endif // COUNTINGSORT_H
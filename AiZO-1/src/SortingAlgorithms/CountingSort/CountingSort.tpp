@@ -0,0 +1,44 @@
+#include <limits>
+
+template <typename T>
+void CountingSort<T>::sort(Vector<T>& values) {
+    int n = values.getSize();
+    if (n <= 1)
+        return;
+
+    int counts[256] = {};
+    T* data = values.getData();
+
+    for (int i = 0; i < n; ++i) {
+        counts[static_cast<unsigned char>(data[i])]++;
+    }
+
+    // Walk the keys in T's own order (negative chars first when signed)
+    int out = 0;
+    for (int key = std::numeric_limits<T>::min(); key <= std::numeric_limits<T>::max(); ++key) {
+        T value = static_cast<T>(key);
+        for (int c = counts[static_cast<unsigned char>(value)]; c > 0; --c) {
+            data[out++] = value;
+        }
+    }
+}
+
+template <typename T>
+void CountingSort<T>::sort(List<T>& list) {
+    if (list.getSize() <= 1)
+        return;
+
+    // Counting needs no scratch copy: rewrite the nodes in key order
+    int counts[256] = {};
+    for (const T& value : list.view()) {
+        counts[static_cast<unsigned char>(value)]++;
+    }
+
+    auto it = list.begin();
+    for (int key = std::numeric_limits<T>::min(); key <= std::numeric_limits<T>::max(); ++key) {
+        T value = static_cast<T>(key);
+        for (int c = counts[static_cast<unsigned char>(value)]; c > 0; --c) {
+            *it++ = value;
+        }
+    }
+}
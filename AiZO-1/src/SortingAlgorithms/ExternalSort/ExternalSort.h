@@ -0,0 +1,89 @@
+#ifndef EXTERNALSORT_H
+#define EXTERNALSORT_H
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include "../../Vector/Vector.h"
+#include "../../DataFile/TextReader.h"
+#include "../../DataFile/TextWriter.h"
+#include "../KWayMerge/LoserTree.h"
+
+// Sorts a data file (count header, one value per line) that does not have
+// to fit in memory. The input is cut into runs that fill the memory
+// budget, each run is sorted in memory by the caller's algorithm and
+// spilled to an unlinked binary temp file, then the runs are k-way merged
+// through a LoserTree. The text input and output go through TextReader
+// and TextWriter (std::from_chars / std::to_chars on large blocks).
+template <typename T>
+class ExternalSort {
+public:
+    using ChunkSorter = std::function<bool(Vector<T>&)>;
+
+    static constexpr long long defaultMemoryLimit = 256LL << 20;
+    static constexpr long long minMemoryLimit = 1LL << 20;
+
+    ExternalSort();
+    ~ExternalSort();
+
+    // Bytes used for a run (plus whatever scratch the chunk algorithm needs)
+    void setMemoryLimit(long long bytes);
+    void setTempDirectory(const std::string& directory);
+
+    int sort(const std::string& inputFile, const std::string& outputFile, const ChunkSorter& sortChunk);
+
+    // Statistics of the last sort() call
+    int getRunGenerationTime() const;
+    int getMergeTime() const;
+    int getRunCount() const;
+    int getMergePasses() const;
+    long long getElementCount() const;
+    long long getSortedCount() const;
+
+private:
+    // A spilled, sorted run
+    struct Run {
+        FILE* file;
+        long long count;
+    };
+
+    // Read position inside one run during a merge
+    struct Cursor {
+        FILE* file;
+        long long remaining;  // elements still on disk
+        T* buffer;
+        int capacity;
+        int position;
+        int filled;
+    };
+
+    static constexpr long long minMergeBuffer = 64LL << 10;
+    static constexpr int maxOpenRuns = 256;
+
+    long long memoryLimit;
+    std::string tempDirectory;
+    Vector<Run> runs;
+
+    int runGenerationTime;
+    int mergeTime;
+    int runCount;
+    int mergePasses;
+    long long elementCount;
+    long long sortedCount;
+
+    int generateRuns(TextReader<T>& input, const ChunkSorter& sortChunk);
+    int mergeAll(TextWriter<T>& output);
+    template <typename Emit>
+    int mergeGroup(Run* group, int count, Emit emit);
+    int maxFanIn() const;
+    int bufferElements(int streams) const;
+
+    FILE* createTempFile() const;
+    void closeRuns();
+
+    static bool refill(Cursor& cursor);
+};
+
+#include "ExternalSort.tpp"
+
+#endif // EXTERNALSORT_H
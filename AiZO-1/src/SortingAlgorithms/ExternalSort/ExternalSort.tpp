@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include <unistd.h>
+#include "../../Timer/Timer.h"
+
+template <typename T>
+ExternalSort<T>::ExternalSort()
+    : memoryLimit(defaultMemoryLimit), runGenerationTime(0), mergeTime(0), runCount(0), mergePasses(0),
+      elementCount(0), sortedCount(0) {
+    const char* directory = std::getenv("TMPDIR");
+    tempDirectory = (directory != nullptr && directory[0] != '\0') ? directory : "/tmp";
+}
+
+template <typename T>
+ExternalSort<T>::~ExternalSort() {
+    closeRuns();
+}
+
+template <typename T>
+void ExternalSort<T>::setMemoryLimit(long long bytes) {
+    memoryLimit = std::max(bytes, minMemoryLimit);
+}
+
+template <typename T>
+void ExternalSort<T>::setTempDirectory(const std::string& directory) {
+    tempDirectory = directory;
+}
+
+template <typename T>
+int ExternalSort<T>::getRunGenerationTime() const {
+    return runGenerationTime;
+}
+
+template <typename T>
+int ExternalSort<T>::getMergeTime() const {
+    return mergeTime;
+}
+
+template <typename T>
+int ExternalSort<T>::getRunCount() const {
+    return runCount;
+}
+
+template <typename T>
+int ExternalSort<T>::getMergePasses() const {
+    return mergePasses;
+}
+
+template <typename T>
+long long ExternalSort<T>::getElementCount() const {
+    return elementCount;
+}
+
+template <typename T>
+long long ExternalSort<T>::getSortedCount() const {
+    return sortedCount;
+}
+
+template <typename T>
+int ExternalSort<T>::sort(const std::string& inputFile, const std::string& outputFile, const ChunkSorter& sortChunk) {
+    closeRuns();
+    runGenerationTime = mergeTime = runCount = mergePasses = 0;
+    elementCount = sortedCount = 0;
+
+    TextReader<T> input;
+    if (input.open(inputFile) != 0) {
+        return -1;
+    }
+
+    Timer timer;
+    timer.start();
+    int status = generateRuns(input, sortChunk);
+    timer.stop();
+    runGenerationTime = timer.result();
+    input.close();
+
+    if (status != 0) {
+        return -1;
+    }
+
+    // The final pass merges at most maxFanIn() runs; the text output gets the
+    // same share of the budget as each of them
+    int finalRuns = std::max(1, std::min(runs.getSize(), maxFanIn()));
+    TextWriter<T> output(1, static_cast<size_t>(bufferElements(finalRuns)) * sizeof(T));
+    if (output.open(outputFile) != 0) {
+        return -1;
+    }
+
+    timer.start();
+    status = mergeAll(output);
+    timer.stop();
+    mergeTime = timer.result();
+
+    if (output.close() != 0) {
+        status = -1;
+    }
+    return status;
+}
+
+// Fill the memory budget, sort it, spill it; repeat until the input ends
+template <typename T>
+int ExternalSort<T>::generateRuns(TextReader<T>& input, const ChunkSorter& sortChunk) {
+    if (!input.readHeader(elementCount)) {
+        std::cerr << "Error reading number of elements.\n";
+        return -1;
+    }
+
+    long long chunkCapacity = std::min<long long>(memoryLimit / static_cast<long long>(sizeof(T)), INT_MAX);
+    Vector<T> chunk(static_cast<int>(std::min(chunkCapacity, std::max(elementCount, 1LL))));
+
+    for (long long remaining = elementCount; remaining > 0;) {
+        int take = static_cast<int>(std::min(remaining, chunkCapacity));
+
+        chunk.clear();
+        for (int i = 0; i < take; ++i) {
+            T value;
+            if (!input.read(value)) {
+                std::cerr << "Error reading value " << (elementCount - remaining + i) << " of " << elementCount << ".\n";
+                return -1;
+            }
+            chunk.pushBack(value);
+        }
+
+        if (!sortChunk(chunk)) {
+            return -1;
+        }
+
+        FILE* file = createTempFile();
+        if (file == nullptr) {
+            return -1;
+        }
+        runs.pushBack(Run{file, take});
+        runCount++;
+
+        if (fwrite(chunk.getData(), sizeof(T), take, file) != static_cast<size_t>(take)) {
+            std::cerr << "Error writing run to temp directory: " << tempDirectory << "\n";
+            return -1;
+        }
+        remaining -= take;
+    }
+    return 0;
+}
+
+// Merge groups of at most maxFanIn() runs into longer runs until a single
+// pass can produce the text output
+template <typename T>
+int ExternalSort<T>::mergeAll(TextWriter<T>& output) {
+    int fanIn = maxFanIn();
+
+    while (runs.getSize() > fanIn) {
+        Vector<Run> merged;
+
+        // Runs written earlier in this pass are only in 'merged' so far,
+        // out of reach of closeRuns()
+        auto closeMerged = [&merged]() {
+            for (int i = 0; i < merged.getSize(); ++i) {
+                if (merged[i].file != nullptr) {
+                    fclose(merged[i].file);
+                }
+            }
+            merged.clear();
+        };
+
+        for (int first = 0; first < runs.getSize(); first += fanIn) {
+            int count = std::min(fanIn, runs.getSize() - first);
+            if (count == 1) {
+                merged.pushBack(runs[first]);
+                runs[first].file = nullptr;
+                continue;
+            }
+
+            FILE* file = createTempFile();
+            if (file == nullptr) {
+                closeMerged();
+                return -1;
+            }
+            merged.pushBack(Run{file, 0});
+
+            // Write through a buffer of the same size as each input's
+            Vector<T> pending(bufferElements(count));
+            int capacity = bufferElements(count);
+            bool writeFailed = false;
+
+            auto flush = [&]() {
+                if (fwrite(pending.getData(), sizeof(T), pending.getSize(), file) != static_cast<size_t>(pending.getSize())) {
+                    writeFailed = true;
+                }
+                pending.clear();
+            };
+
+            int status = mergeGroup(&runs[first], count, [&](const T& value) {
+                pending.pushBack(value);
+                if (pending.getSize() == capacity) flush();
+            });
+            flush();
+
+            if (status != 0 || writeFailed) {
+                std::cerr << "Error writing merged run to temp directory: " << tempDirectory << "\n";
+                closeMerged();
+                return -1;
+            }
+
+            for (int i = first; i < first + count; ++i) {
+                merged[merged.getSize() - 1].count += runs[i].count;
+                fclose(runs[i].file);
+                runs[i].file = nullptr;
+            }
+        }
+
+        runs = std::move(merged);
+        mergePasses++;
+    }
+
+    // Final pass straight into the text output
+    output.writeHeader(elementCount);
+
+    long long written = 0;
+    bool inOrder = true;
+    T previous{};
+
+    int status = mergeGroup(runs.getData(), runs.getSize(), [&](const T& value) {
+        if (inOrder && written > 0 && !(previous <= value)) {
+            inOrder = false;
+        }
+        if (inOrder) {
+            sortedCount++;
+        }
+        previous = value;
+        written++;
+        output.append(value);
+    });
+    if (runs.getSize() > 0) {
+        mergePasses++;
+    }
+
+    if (status != 0 || written != elementCount) {
+        std::cerr << "Error merging runs: wrote " << written << " of " << elementCount << " elements.\n";
+        return -1;
+    }
+    return 0;
+}
+
+// Loser-tree k-way merge; emit() receives the values in ascending order
+template <typename T>
+template <typename Emit>
+int ExternalSort<T>::mergeGroup(Run* group, int count, Emit emit) {
+    if (count == 0) {
+        return 0;
+    }
+
+    int perRun = bufferElements(count);
+    Vector<T> arena;
+    arena.resizeUninitialized(perRun * count);
+
+    Vector<Cursor> cursors(count);
+    LoserTree<T> tree(count);
+
+    for (int i = 0; i < count; ++i) {
+        rewind(group[i].file);
+        cursors.pushBack(Cursor{group[i].file, group[i].count, arena.getData() + static_cast<long long>(i) * perRun, perRun, 0, 0});
+        if (refill(cursors[i])) {
+            tree.setHead(i, cursors[i].buffer[0]);
+        } else if (group[i].count > 0) {
+            return -1;
+        } else {
+            tree.setExhausted(i);
+        }
+    }
+    tree.build();
+
+    while (!tree.empty()) {
+        Cursor& cursor = cursors[tree.winner()];
+        emit(tree.top());
+
+        if (++cursor.position < cursor.filled || refill(cursor)) {
+            tree.replaceTop(cursor.buffer[cursor.position]);
+        } else if (cursor.remaining > 0) {
+            return -1;
+        } else {
+            tree.popTop();
+        }
+    }
+    return 0;
+}
+
+// Bounded by open files and by the smallest useful read buffer
+template <typename T>
+int ExternalSort<T>::maxFanIn() const {
+    long long byMemory = memoryLimit / minMergeBuffer - 1;
+    return static_cast<int>(std::max(2LL, std::min<long long>(byMemory, maxOpenRuns)));
+}
+
+// Elements per stream when 'streams' inputs and one output share the budget
+template <typename T>
+int ExternalSort<T>::bufferElements(int streams) const {
+    long long elements = memoryLimit / static_cast<long long>(sizeof(T)) / (streams + 1);
+    return static_cast<int>(std::max(1LL, std::min(elements, 1LL << 20)));
+}
+
+// The file is unlinked right away, so it disappears when closed or on exit
+template <typename T>
+FILE* ExternalSort<T>::createTempFile() const {
+    std::string path = tempDirectory + "/aizo-run-XXXXXX";
+    int descriptor = mkstemp(&path[0]);
+    if (descriptor < 0) {
+        std::cerr << "Could not create temp file in: " << tempDirectory << "\n";
+        return nullptr;
+    }
+    unlink(path.c_str());
+
+    FILE* file = fdopen(descriptor, "w+b");
+    if (file == nullptr) {
+        close(descriptor);
+        std::cerr << "Could not open temp file in: " << tempDirectory << "\n";
+    }
+    return file;
+}
+
+template <typename T>
+void ExternalSort<T>::closeRuns() {
+    for (int i = 0; i < runs.getSize(); ++i) {
+        if (runs[i].file != nullptr) {
+            fclose(runs[i].file);
+        }
+    }
+    runs.clear();
+}
+
+// Load the next block of a run; false once the run is exhausted or unreadable
+template <typename T>
+bool ExternalSort<T>::refill(Cursor& cursor) {
+    cursor.position = 0;
+    cursor.filled = 0;
+    if (cursor.remaining == 0) {
+        return false;
+    }
+
+    size_t wanted = static_cast<size_t>(std::min<long long>(cursor.remaining, cursor.capacity));
+    if (fread(cursor.buffer, sizeof(T), wanted, cursor.file) != wanted) {
+        return false;  // remaining stays positive, callers report the short read
+    }
+
+    cursor.filled = static_cast<int>(wanted);
+    cursor.remaining -= static_cast<long long>(wanted);
+    return true;
+}
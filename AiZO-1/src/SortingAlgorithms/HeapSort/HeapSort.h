@@ -3,17 +3,51 @@
 
 #include "../../List/List.h"
 #include "../../Vector/Vector.h"
+#include "../SortStats/SortStats.h"
 
-template <typename T>
+// Classic: the original recursive binary sift-down, two comparisons per level.
+// Iterative: binary sift-down as a loop that moves a hole instead of swapping.
+// BottomUp: Floyd's variant, walks the hole down to a leaf along the larger
+//   children (one comparison per level) and sifts the value back up from there.
+// FourAry/EightAry: bottom-up on a 4-/8-ary heap whose child groups start on
+//   a group-size boundary, so all children of a node share one cache line.
+// Every variant but Classic prefetches the grandchildren of the node it visits.
+enum class HeapVariant { Classic, Iterative, BottomUp, FourAry, EightAry };
+
+template <typename T, typename Stats = NoStats>
 class HeapSort {
 public:
-    HeapSort() {}
+    HeapSort() : variant(HeapVariant::Classic), prefetch(true) {}
     ~HeapSort() {}
 
+    void setVariant(HeapVariant heapVariant) { variant = heapVariant; }
+    void setPrefetch(bool enabled) { prefetch = enabled; }
+
     void sort(List<T>& list);
+    void sort(Vector<T>& values);
+
+    const Stats& getStats() const { return stats; }
 
 private:
+    HeapVariant variant;
+    bool prefetch;
+    Stats stats;
+
     void heapify(Vector<T>& arr, int n, int i);
+    void sortClassic(Vector<T>& values);
+
+    template <int D>
+    long maxChild(const T* heap, long first, long n);
+    template <int D>
+    void prefetchGrandchildren(const T* heap, long first, long n) const;
+    template <int D>
+    void siftTopDown(T* heap, long n, long node, T value);
+    template <int D>
+    void siftBottomUp(T* heap, long n, long node, T value);
+    template <int D, bool bottomUp>
+    void sortHeap(T* heap, long n);
+    template <int D>
+    void sortAligned(Vector<T>& values);
 };
 
 #endif // HEAPSORT_H
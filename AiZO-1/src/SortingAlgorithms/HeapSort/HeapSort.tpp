@@ -1,13 +1,17 @@
-template <typename T>
-void HeapSort<T>::heapify(Vector<T>& arr, int n, int i) {
+#include <cstdint>
+#include <utility>
+
+template <typename T, typename Stats>
+void HeapSort<T, Stats>::heapify(Vector<T>& arr, int n, int i) {
+    stats.enter();
     int largest = i;
     int left = 2 * i + 1;
     int right = 2 * i + 2;
 
-    if (left < n && arr[left] > arr[largest])
+    if (left < n && stats.greater(arr[left], arr[largest]))
         largest = left;
 
-    if (right < n && arr[right] > arr[largest])
+    if (right < n && stats.greater(arr[right], arr[largest]))
         largest = right;
 
     if (largest != i) {
@@ -15,25 +19,16 @@ void HeapSort<T>::heapify(Vector<T>& arr, int n, int i) {
         T temp = arr[i];
         arr[i] = arr[largest];
         arr[largest] = temp;
-        
+        stats.swap();
+
         // Recursively heapify the affected sub-tree
         heapify(arr, n, largest);
     }
+    stats.leave();
 }
 
-template <typename T>
-void HeapSort<T>::sort(List<T>& list) {
-    if (list.getSize() <= 1)
-        return;
-
-    Vector<T> values;    
-    Node<T>* current = list.getList();
-    
-    while (current) {
-        values.pushBack(current->value);
-        current = current->next;
-    }
-
+template <typename T, typename Stats>
+void HeapSort<T, Stats>::sortClassic(Vector<T>& values) {
     int n = values.getSize();
 
     // Build heap (rearrange array)
@@ -46,14 +41,201 @@ void HeapSort<T>::sort(List<T>& list) {
         T temp = values[0];
         values[0] = values[i];
         values[i] = temp;
-        
+        stats.swap();
+
         // Call max heapify on the reduced heap
         heapify(values, i, 0);
     }
+}
+
+// Index of the largest of the children heap[first..n); the selection is
+// arithmetic so random keys don't cost a mispredicted branch per child
+template <typename T, typename Stats>
+template <int D>
+long HeapSort<T, Stats>::maxChild(const T* heap, long first, long n) {
+    if (first + D <= n) {
+        // Pairwise tournament: log2(D) dependent rounds instead of D-1
+        long winner[D];
+        for (int c = 0; c < D; ++c) {
+            winner[c] = first + c;
+        }
+        for (int width = D / 2; width > 0; width /= 2) {
+            for (int c = 0; c < width; ++c) {
+                long left = winner[2 * c], right = winner[2 * c + 1];
+                winner[c] = left + (right - left) * stats.less(heap[left], heap[right]);
+            }
+        }
+        return winner[0];
+    }
+
+    long best = first;
+    for (long child = first + 1; child < n; ++child) {
+        best += (child - best) * stats.less(heap[best], heap[child]);
+    }
+    return best;
+}
+
+// The children of every child of a node are D*D consecutive slots starting
+// at D*first+1; fetch them while this level is being compared
+template <typename T, typename Stats>
+template <int D>
+void HeapSort<T, Stats>::prefetchGrandchildren(const T* heap, long first, long n) const {
+    constexpr int lines = (D * D * sizeof(T) + 63) / 64;
+    long grandchild = D * first + 1;
+    if (!prefetch || grandchild >= n)
+        return;
+
+    const char* begin = reinterpret_cast<const char*>(heap + grandchild);
+    for (int line = 0; line < lines; ++line) {
+        __builtin_prefetch(begin + 64 * line);
+    }
+}
+
+// Move the hole at 'node' down while a child is larger than 'value'
+template <typename T, typename Stats>
+template <int D>
+void HeapSort<T, Stats>::siftTopDown(T* heap, long n, long node, T value) {
+    long first;
+    while ((first = D * node + 1) < n) {
+        prefetchGrandchildren<D>(heap, first, n);
+        long best = maxChild<D>(heap, first, n);
+        if (!stats.less(value, heap[best]))
+            break;
+
+        heap[node] = heap[best];
+        stats.move();
+        node = best;
+    }
+    heap[node] = value;
+}
+
+// Floyd: walk the hole to a leaf along the larger children without looking
+// at 'value' (it usually came from the bottom and belongs near a leaf),
+// then move it back up to where it fits
+template <typename T, typename Stats>
+template <int D>
+void HeapSort<T, Stats>::siftBottomUp(T* heap, long n, long node, T value) {
+    long hole = node;
+    long first;
+    while ((first = D * hole + 1) < n) {
+        prefetchGrandchildren<D>(heap, first, n);
+        long best = maxChild<D>(heap, first, n);
+        heap[hole] = heap[best];
+        stats.move();
+        hole = best;
+    }
+
+    while (hole > node) {
+        long parent = (hole - 1) / D;
+        if (!stats.less(heap[parent], value))
+            break;
+
+        heap[hole] = heap[parent];
+        stats.move();
+        hole = parent;
+    }
+    heap[hole] = value;
+}
+
+template <typename T, typename Stats>
+template <int D, bool bottomUp>
+void HeapSort<T, Stats>::sortHeap(T* heap, long n) {
+    for (long node = (n - 2) / D; node >= 0; --node) {
+        if (bottomUp) siftBottomUp<D>(heap, n, node, heap[node]);
+        else siftTopDown<D>(heap, n, node, heap[node]);
+    }
+
+    for (long end = n - 1; end > 0; --end) {
+        T value = heap[end];
+        heap[end] = heap[0];
+        stats.move();
+        if (bottomUp) siftBottomUp<D>(heap, end, 0, value);
+        else siftTopDown<D>(heap, end, 0, value);
+    }
+}
+
+// Child groups start at heap index D*k+1. The heap starts 'skip' (< D)
+// slots into the array so that slot 1 falls on a group-size boundary (capped
+// at a cache line); the skipped slots are merged in after the heap is sorted.
+template <typename T, typename Stats>
+template <int D>
+void HeapSort<T, Stats>::sortAligned(Vector<T>& values) {
+    T* data = values.getData();
+    long n = values.getSize();
+
+    long groupBytes = static_cast<long>(sizeof(T)) * D < 64 ? static_cast<long>(sizeof(T)) * D : 64;
+    long skip = 0;
+    if ((groupBytes & (groupBytes - 1)) == 0 && groupBytes % static_cast<long>(sizeof(T)) == 0) {
+        long misalignment = static_cast<long>((reinterpret_cast<uintptr_t>(data) + sizeof(T)) % groupBytes);
+        skip = ((groupBytes - misalignment) % groupBytes) / static_cast<long>(sizeof(T));
+    }
+    if (skip >= n - 1)
+        skip = 0;
+
+    sortHeap<D, true>(data + skip, n - skip);
+    if (skip == 0)
+        return;
+
+    // Sort the skipped slots, then merge them in front of the sorted heap.
+    // The write position never passes the heap read position.
+    T skipped[D];
+    for (long i = 0; i < skip; ++i) {
+        T value = data[i];
+        long j = i;
+        while (j > 0 && stats.less(value, skipped[j - 1])) {
+            skipped[j] = skipped[j - 1];
+            --j;
+        }
+        skipped[j] = value;
+    }
+
+    long out = 0, next = skip, i = 0;
+    while (i < skip) {
+        if (next < n && stats.less(data[next], skipped[i])) data[out++] = data[next++];
+        else data[out++] = skipped[i++];
+        stats.move();
+    }
+}
+
+template <typename T, typename Stats>
+void HeapSort<T, Stats>::sort(Vector<T>& values) {
+    if (values.getSize() <= 1)
+        return;
+
+    switch (variant) {
+        case HeapVariant::Iterative:
+            sortHeap<2, false>(values.getData(), values.getSize());
+            break;
+        case HeapVariant::BottomUp:
+            sortHeap<2, true>(values.getData(), values.getSize());
+            break;
+        case HeapVariant::FourAry:
+            sortAligned<4>(values);
+            break;
+        case HeapVariant::EightAry:
+            sortAligned<8>(values);
+            break;
+        default:
+            sortClassic(values);
+            break;
+    }
+}
 
-    list.clear();
-    
-    for (int i = 0; i < values.getSize(); i++) {
-        list.insertAtTail(values[i]);
+template <typename T, typename Stats>
+void HeapSort<T, Stats>::sort(List<T>& list) {
+    if (list.getSize() <= 1)
+        return;
+
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
     }
-}
\ No newline at end of file
+
+    sort(values);
+
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
+    }
+}
@@ -3,19 +3,43 @@
 
 #include "../../List/List.h"
 #include "../../Vector/Vector.h"
+#include "../SortStats/SortStats.h"
 
-template <typename T>
+// Linear: the original shift loop, bounds check and compare in every step.
+// Sentinel: first rotates the minimum to the front, so the shift loop stops
+//   at it without checking j >= 0.
+// Binary: finds the slot by binary search and shifts the block in one go
+//   (memmove for trivially copyable T).
+// All three are stable.
+enum class InsertionVariant { Linear, Sentinel, Binary };
+
+template <typename T, typename Stats = NoStats>
 class InsertionSort {
 public:
-    InsertionSort() {}
+    // Finisher for the short ranges of hybrid sorters; the fastest variant
+    // up to 32 elements in './benchmarks insertion'
+    static constexpr InsertionVariant smallRangeVariant = InsertionVariant::Sentinel;
+
+    InsertionSort() : variant(InsertionVariant::Linear) {}
     ~InsertionSort() {}
 
+    void setVariant(InsertionVariant insertionVariant) { variant = insertionVariant; }
+
     void sort(List<T>& list);
+    void sort(Vector<T>& values);
+    void sort(T* data, int n);
+
+    const Stats& getStats() const { return stats; }
 
 private:
-    void insertionSort(Vector<T>& arr);
-};
+    InsertionVariant variant;
+    Stats stats;
 
-#endif // INSERTIONSORT_H
+    void insertionSort(T* data, int n);
+    void sentinelInsertionSort(T* data, int n);
+    void binaryInsertionSort(T* data, int n);
+};
 
 #include "InsertionSort.tpp"
+
+#endif // INSERTIONSORT_H
@@ -1,38 +1,116 @@
-template <typename T>
-void InsertionSort<T>::insertionSort(Vector<T>& arr) {
-    int n = arr.getSize();
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::insertionSort(T* arr, int n) {
     for (int i = 1; i < n; ++i) {
         T key = arr[i];
         int j = i - 1;
 
         // Move elements of arr[0..i-1] that are greater than key
         // to one position ahead of their current position
-        while (j >= 0 && arr[j] > key) {
+        while (j >= 0 && stats.greater(arr[j], key)) {
+            arr[j + 1] = arr[j];
+            stats.move();
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::sentinelInsertionSort(T* arr, int n) {
+    // The first minimum goes to arr[0] (the elements before it move up by
+    // one, keeping the sort stable) and guards every shift loop below
+    int smallest = 0;
+    for (int i = 1; i < n; ++i) {
+        if (stats.less(arr[i], arr[smallest]))
+            smallest = i;
+    }
+    T minimum = arr[smallest];
+    for (int j = smallest; j > 0; --j) {
+        arr[j] = arr[j - 1];
+        stats.move();
+    }
+    arr[0] = minimum;
+
+    for (int i = 2; i < n; ++i) {
+        T key = arr[i];
+        int j = i - 1;
+        while (stats.greater(arr[j], key)) {
             arr[j + 1] = arr[j];
+            stats.move();
             j--;
         }
         arr[j + 1] = key;
     }
 }
 
-template <typename T>
-void InsertionSort<T>::sort(List<T>& list) {
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::binaryInsertionSort(T* arr, int n) {
+    for (int i = 1; i < n; ++i) {
+        // Already in place: one comparison, no search
+        if (!stats.less(arr[i], arr[i - 1]))
+            continue;
+
+        // Upper bound of key in arr[0..i-1), so equal keys keep their order
+        T key = arr[i];
+        int low = 0, high = i - 1;
+        while (low < high) {
+            int middle = low + (high - low) / 2;
+            if (stats.less(key, arr[middle])) high = middle;
+            else low = middle + 1;
+        }
+
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(arr + low + 1, arr + low, sizeof(T) * (i - low));
+        } else {
+            std::move_backward(arr + low, arr + i, arr + i + 1);
+        }
+        stats.move(i - low);
+        arr[low] = key;
+    }
+}
+
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::sort(T* data, int n) {
+    if (n <= 1)
+        return;
+
+    switch (variant) {
+        case InsertionVariant::Sentinel:
+            sentinelInsertionSort(data, n);
+            break;
+        case InsertionVariant::Binary:
+            binaryInsertionSort(data, n);
+            break;
+        default:
+            insertionSort(data, n);
+            break;
+    }
+}
+
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::sort(Vector<T>& values) {
+    sort(values.getData(), values.getSize());
+}
+
+template <typename T, typename Stats>
+void InsertionSort<T, Stats>::sort(List<T>& list) {
     if (list.getSize() <= 1)
         return;
 
-    Vector<T> values;
-    Node<T>* current = list.getList();
-    
-    while (current) {
-        values.pushBack(current->value);
-        current = current->next;
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
     }
 
-    insertionSort(values);
+    sort(values);
 
-    list.clear(); // Clear the original list
-    
-    for (int i = 0; i < values.getSize(); i++) {
-        list.insertAtTail(values[i]);
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
     }
-}
\ No newline at end of file
+}
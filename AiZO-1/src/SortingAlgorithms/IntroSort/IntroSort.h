@@ -0,0 +1,41 @@
+#ifndef INTROSORT_H
+#define INTROSORT_H
+
+#include "../../List/List.h"
+#include "../../Vector/Vector.h"
+#include "../PivotSelector/PivotSelector.h"
+#include "../CountingSort/CountingSort.h"
+#include "../SortingKernels/SortingKernels.h"
+#include "../InsertionSort/InsertionSort.h"
+
+// Hybrid quicksort: pluggable pivot, insertion sort for small ranges and
+// a heapsort fallback once recursion gets deeper than 2*log2(n).
+// int/float/double ranges of up to 32 elements are finished by the
+// sorting-network kernels instead. 8-bit types are counted, not compared.
+template <typename T>
+class IntroSort {
+public:
+    IntroSort() {}
+    ~IntroSort() {}
+
+    void sort(List<T>& list, char pivot_position = '3');  // 'l', 'm', 'r', 'x', '3', 'n'
+    void sort(Vector<T>& values, char pivot_position = '3');
+
+    // Ranges at most this long are finished by insertion sort
+    // (InsertionSort's smallRangeVariant)
+    static constexpr int insertionCutoff = 16;
+
+    // Ranges at most this long leave the partitioning loop
+    static constexpr int smallRange = SmallSortKernel<T>::available ? SortingKernels::maxBlock : insertionCutoff;
+
+private:
+    int partition(Vector<T>& array, int left, int right, char pivot_position);
+    void introSort(Vector<T>& array, int left, int right, int depthLimit, char pivot_position);
+    void finishSmallRange(Vector<T>& array, int left, int right);
+    void heapSort(Vector<T>& array, int left, int right);
+    void siftDown(Vector<T>& array, int base, int n, int i);
+};
+
+#include "IntroSort.tpp"
+
+#endif // INTROSORT_H
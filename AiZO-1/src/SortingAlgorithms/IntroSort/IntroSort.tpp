@@ -0,0 +1,131 @@
+#include <utility>
+
+// Hoare partition. The chosen pivot is moved to 'left' first, which keeps
+// the split point below 'right' for every strategy (including 'r').
+template <typename T>
+int IntroSort<T>::partition(Vector<T>& array, int left, int right, char pivot_position) {
+    int pivotIndex = PivotSelector<T>::select(array, left, right, pivot_position);
+    std::swap(array[left], array[pivotIndex]);
+    T pivot = array[left];
+
+    int l = left - 1;
+    int r = right + 1;
+
+    while (true) {
+        do { ++l; } while (array[l] < pivot);
+        do { --r; } while (array[r] > pivot);
+
+        if (l >= r)
+            return r;
+
+        std::swap(array[l], array[r]);
+    }
+}
+
+template <typename T>
+void IntroSort<T>::finishSmallRange(Vector<T>& array, int left, int right) {
+    if constexpr (SmallSortKernel<T>::available) {
+        if (right >= left) {
+            SmallSortKernel<T>::sort(&array[left], right - left + 1);
+        }
+    } else if (right > left) {
+        InsertionSort<T> finisher;
+        finisher.setVariant(InsertionSort<T>::smallRangeVariant);
+        finisher.sort(&array[left], right - left + 1);
+    }
+}
+
+// Iterative max-heap sift-down on array[base..base+n)
+template <typename T>
+void IntroSort<T>::siftDown(Vector<T>& array, int base, int n, int i) {
+    T value = array[base + i];
+
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= n)
+            break;
+        if (child + 1 < n && array[base + child] < array[base + child + 1])
+            child++;
+        if (!(value < array[base + child]))
+            break;
+
+        array[base + i] = array[base + child];
+        i = child;
+    }
+    array[base + i] = value;
+}
+
+template <typename T>
+void IntroSort<T>::heapSort(Vector<T>& array, int left, int right) {
+    int n = right - left + 1;
+
+    for (int i = n / 2 - 1; i >= 0; i--)
+        siftDown(array, left, n, i);
+
+    for (int i = n - 1; i > 0; i--) {
+        std::swap(array[left], array[left + i]);
+        siftDown(array, left, i, 0);
+    }
+}
+
+// Recurse into the smaller part and loop on the larger one, so the stack
+// never holds more than log2(n) frames
+template <typename T>
+void IntroSort<T>::introSort(Vector<T>& array, int left, int right, int depthLimit, char pivot_position) {
+    while (right - left + 1 > smallRange) {
+        if (depthLimit == 0) {
+            heapSort(array, left, right);
+            return;
+        }
+        depthLimit--;
+
+        int p = partition(array, left, right, pivot_position);
+
+        if (p - left < right - p) {
+            introSort(array, left, p, depthLimit, pivot_position);
+            left = p + 1;
+        } else {
+            introSort(array, p + 1, right, depthLimit, pivot_position);
+            right = p;
+        }
+    }
+
+    finishSmallRange(array, left, right);
+}
+
+template <typename T>
+void IntroSort<T>::sort(Vector<T>& values, char pivot_position) {
+    if (values.getSize() <= 1)
+        return;
+
+    if constexpr (UsesCountingSort<T>::value) {
+        CountingSort<T> counting;
+        counting.sort(values);
+        return;
+    }
+
+    int depthLimit = 0;
+    for (int n = values.getSize(); n > 1; n >>= 1)
+        depthLimit += 2;
+
+    introSort(values, 0, values.getSize() - 1, depthLimit, pivot_position);
+}
+
+template <typename T>
+void IntroSort<T>::sort(List<T>& list, char pivot_position) {
+    if (list.getSize() <= 1)
+        return;
+
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
+    }
+
+    sort(values, pivot_position);
+
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
+    }
+}
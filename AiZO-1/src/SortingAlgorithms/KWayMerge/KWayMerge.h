@@ -0,0 +1,50 @@
+#ifndef KWAYMERGE_H
+#define KWAYMERGE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../Vector/Vector.h"
+#include "../../DataFile/TextReader.h"
+#include "../../DataFile/TextWriter.h"
+#include "LoserTree.h"
+
+// Merges already-sorted data files (count header, one value per line) into
+// one sorted file in a single streaming pass through a loser tree. Every
+// input is parsed by its own TextReader and the output is formatted by a
+// TextWriter (std::from_chars / std::to_chars on large blocks), so memory
+// stays at (k + 1) * buffer size however large the files are.
+template <typename T>
+class KWayMerge {
+public:
+    static constexpr long long defaultBufferSize = 1LL << 20;
+
+    KWayMerge();
+    ~KWayMerge();
+
+    void setBufferSize(long long bytes);
+
+    int merge(const Vector<std::string>& inputFiles, const std::string& outputFile);
+
+    // Statistics of the last merge() call
+    int getMergeTime() const;
+    long long getElementCount() const;
+    long long getSortedCount() const;
+    int getUnsortedInputs() const;
+
+private:
+    long long bufferSize;
+    std::vector<std::unique_ptr<TextReader<T>>> inputs;
+
+    int mergeTime;
+    long long elementCount;
+    long long sortedCount;
+    int unsortedInputs;
+
+    int openInputs(const Vector<std::string>& inputFiles, Vector<long long>& remaining);
+    void closeInputs();
+};
+
+#include "KWayMerge.tpp"
+
+#endif // KWAYMERGE_H
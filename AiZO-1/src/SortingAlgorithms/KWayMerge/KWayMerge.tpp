@@ -0,0 +1,158 @@
+#include <iostream>
+#include "../../DataFile/TextFormat.h"
+#include "../../Timer/Timer.h"
+
+template <typename T>
+KWayMerge<T>::KWayMerge()
+    : bufferSize(defaultBufferSize), mergeTime(0), elementCount(0), sortedCount(0), unsortedInputs(0) {}
+
+template <typename T>
+KWayMerge<T>::~KWayMerge() {
+    closeInputs();
+}
+
+template <typename T>
+void KWayMerge<T>::setBufferSize(long long bytes) {
+    bufferSize = bytes > 4096 ? bytes : 4096;
+}
+
+template <typename T>
+int KWayMerge<T>::getMergeTime() const {
+    return mergeTime;
+}
+
+template <typename T>
+long long KWayMerge<T>::getElementCount() const {
+    return elementCount;
+}
+
+template <typename T>
+long long KWayMerge<T>::getSortedCount() const {
+    return sortedCount;
+}
+
+template <typename T>
+int KWayMerge<T>::getUnsortedInputs() const {
+    return unsortedInputs;
+}
+
+template <typename T>
+int KWayMerge<T>::merge(const Vector<std::string>& inputFiles, const std::string& outputFile) {
+    mergeTime = 0;
+    elementCount = sortedCount = 0;
+    unsortedInputs = 0;
+
+    Timer timer;
+    timer.start();
+
+    Vector<long long> remaining;
+    if (openInputs(inputFiles, remaining) != 0) {
+        closeInputs();
+        return -1;
+    }
+
+    TextWriter<T> output(1, static_cast<size_t>(bufferSize));
+    if (output.open(outputFile) != 0) {
+        closeInputs();
+        return -1;
+    }
+
+    int k = static_cast<int>(inputs.size());
+    for (int i = 0; i < k; ++i) {
+        elementCount += remaining[i];
+    }
+    output.writeHeader(elementCount);
+
+    // Pull the next value of input i into the tree, or retire the input
+    bool readFailed = false;
+    Vector<char> reportedUnsorted(k);
+    for (int i = 0; i < k; ++i) reportedUnsorted.pushBack(0);
+
+    auto next = [&](int i, T& value) {
+        if (remaining[i] == 0) return false;
+        if (!inputs[i]->read(value)) {
+            std::cerr << "Error reading value from " << inputFiles[i] << ".\n";
+            readFailed = true;
+            return false;
+        }
+        remaining[i]--;
+        return true;
+    };
+
+    LoserTree<T> tree(k);
+    for (int i = 0; i < k; ++i) {
+        T value;
+        if (next(i, value)) tree.setHead(i, value);
+        else tree.setExhausted(i);
+    }
+    tree.build();
+
+    long long written = 0;
+    bool inOrder = true;
+    T previous{};
+
+    while (!readFailed && !tree.empty()) {
+        T value = tree.top();
+        int source = tree.winner();
+
+        if (inOrder && written > 0 && !(previous <= value)) {
+            inOrder = false;
+        }
+        if (inOrder) {
+            sortedCount++;
+        }
+        output.append(value);
+        previous = value;
+        written++;
+
+        T following;
+        if (next(source, following)) {
+            if (TextFormat<T>::before(following, value) && !reportedUnsorted[source]) {
+                std::cerr << "Warning: " << inputFiles[source] << " is not sorted; output will not be either.\n";
+                reportedUnsorted[source] = 1;
+                unsortedInputs++;
+            }
+            tree.replaceTop(following);
+        } else {
+            tree.popTop();
+        }
+    }
+
+    bool writeFailed = output.close() != 0;
+    closeInputs();
+
+    timer.stop();
+    mergeTime = timer.result();
+
+    if (readFailed || writeFailed || written != elementCount) {
+        std::cerr << "Error merging: wrote " << written << " of " << elementCount << " elements.\n";
+        return -1;
+    }
+    return 0;
+}
+
+// Open every input with its own buffer and read its count header
+template <typename T>
+int KWayMerge<T>::openInputs(const Vector<std::string>& inputFiles, Vector<long long>& remaining) {
+    closeInputs();
+
+    for (int i = 0; i < inputFiles.getSize(); ++i) {
+        inputs.emplace_back(new TextReader<T>(static_cast<size_t>(bufferSize)));
+        if (inputs.back()->open(inputFiles[i]) != 0) {
+            return -1;
+        }
+
+        long long count;
+        if (!inputs.back()->readHeader(count)) {
+            std::cerr << "Error reading number of elements in: " << inputFiles[i] << "\n";
+            return -1;
+        }
+        remaining.pushBack(count);
+    }
+    return 0;
+}
+
+template <typename T>
+void KWayMerge<T>::closeInputs() {
+    inputs.clear();
+}
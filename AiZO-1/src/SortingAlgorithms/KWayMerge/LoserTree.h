@@ -0,0 +1,42 @@
+#ifndef LOSERTREE_H
+#define LOSERTREE_H
+
+#include "../../Vector/Vector.h"
+#include "../../DataFile/TextFormat.h"
+
+// Tournament tree of losers over k sorted sources. Each internal node keeps
+// the source that lost the match played there, so replacing the winner's
+// key replays a single leaf-to-root path: ceil(log2 k) comparisons against
+// fixed opponents, fewer than a binary heap's sift-down. Ties go to the
+// lower source index, which keeps the merge stable.
+template <typename T>
+class LoserTree {
+public:
+    explicit LoserTree(int sources);
+
+    // Set up every source with setHead() or setExhausted(), then build()
+    void setHead(int source, const T& key);
+    void setExhausted(int source);
+    void build();
+
+    bool empty() const;
+    int winner() const;
+    const T& top() const;
+
+    // The winner moved on to its next key, or ran dry
+    void replaceTop(const T& key);
+    void popTop();
+
+private:
+    int k;
+    Vector<T> keys;
+    Vector<char> exhausted;
+    Vector<int> tree;  // tree[0] is the winner, tree[1..k-1] the losers
+
+    bool beats(int a, int b) const;
+    void replay(int source);
+};
+
+#include "LoserTree.tpp"
+
+#endif // LOSERTREE_H
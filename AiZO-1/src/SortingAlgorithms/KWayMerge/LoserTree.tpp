@@ -0,0 +1,90 @@
+#include <utility>
+
+template <typename T>
+LoserTree<T>::LoserTree(int sources) : k(sources > 0 ? sources : 1), keys(k), exhausted(k), tree(k) {
+    for (int i = 0; i < k; ++i) {
+        keys.pushBack(T());
+        exhausted.pushBack(1);
+        tree.pushBack(0);
+    }
+}
+
+template <typename T>
+void LoserTree<T>::setHead(int source, const T& key) {
+    keys[source] = key;
+    exhausted[source] = 0;
+}
+
+template <typename T>
+void LoserTree<T>::setExhausted(int source) {
+    exhausted[source] = 1;
+}
+
+// Leaves sit at positions k..2k-1 of an implicit tree, so any k works
+template <typename T>
+void LoserTree<T>::build() {
+    Vector<int> winners(2 * k);
+    winners.resizeUninitialized(2 * k);
+    for (int i = 0; i < k; ++i) {
+        winners[k + i] = i;
+    }
+
+    for (int node = k - 1; node >= 1; --node) {
+        int left = winners[2 * node];
+        int right = winners[2 * node + 1];
+        if (beats(right, left)) std::swap(left, right);
+        winners[node] = left;
+        tree[node] = right;
+    }
+    tree[0] = (k == 1) ? 0 : winners[1];
+}
+
+template <typename T>
+bool LoserTree<T>::empty() const {
+    return exhausted[tree[0]] != 0;
+}
+
+template <typename T>
+int LoserTree<T>::winner() const {
+    return tree[0];
+}
+
+template <typename T>
+const T& LoserTree<T>::top() const {
+    return keys[tree[0]];
+}
+
+template <typename T>
+void LoserTree<T>::replaceTop(const T& key) {
+    int source = tree[0];
+    keys[source] = key;
+    replay(source);
+}
+
+template <typename T>
+void LoserTree<T>::popTop() {
+    int source = tree[0];
+    exhausted[source] = 1;
+    replay(source);
+}
+
+// Exhausted sources lose to everything; equal keys go to the lower index
+template <typename T>
+bool LoserTree<T>::beats(int a, int b) const {
+    if (exhausted[a]) return false;
+    if (exhausted[b]) return true;
+    if (TextFormat<T>::before(keys[a], keys[b])) return true;
+    if (TextFormat<T>::before(keys[b], keys[a])) return false;
+    return a < b;
+}
+
+template <typename T>
+void LoserTree<T>::replay(int source) {
+    int candidate = source;
+    for (int node = (source + k) / 2; node >= 1; node /= 2) {
+        if (beats(tree[node], candidate)) {
+            std::swap(tree[node], candidate);
+        }
+    }
+    tree[0] = candidate;
+}
@@ -0,0 +1,28 @@
+#ifndef PIVOTSELECTOR_H
+#define PIVOTSELECTOR_H
+
+#include "../../Vector/Vector.h"
+#include "../../RandomGenerator/RandomGenerator.h"
+
+// Pivot strategies shared by the quicksort family:
+//   'l' left, 'm' middle, 'r' right, 'x' random,
+//   '3' median of left/middle/right, 'n' Tukey's ninther
+template <typename T>
+class PivotSelector {
+public:
+    // Index of the pivot element in array[left..right]
+    static int select(const Vector<T>& array, int left, int right, char strategy);
+
+    static bool isValid(char strategy);
+
+    // Below this size the ninther falls back to median of three
+    static constexpr int nintherThreshold = 128;
+
+private:
+    static int medianOfThree(const Vector<T>& array, int a, int b, int c);
+    static int randomIndex(int left, int right);
+};
+
+#include "PivotSelector.tpp"
+
+#endif // PIVOTSELECTOR_H
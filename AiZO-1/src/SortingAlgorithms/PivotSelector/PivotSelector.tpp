@@ -0,0 +1,57 @@
+template <typename T>
+bool PivotSelector<T>::isValid(char strategy) {
+    switch (strategy) {
+        case 'l': case 'm': case 'r': case 'x': case '3': case 'n':
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+int PivotSelector<T>::medianOfThree(const Vector<T>& array, int a, int b, int c) {
+    if (array[a] < array[b]) {
+        if (array[b] < array[c]) return b;
+        return array[a] < array[c] ? c : a;
+    }
+    if (array[a] < array[c]) return a;
+    return array[b] < array[c] ? c : b;
+}
+
+// One generator per thread, seeded once and reused for every partition
+template <typename T>
+int PivotSelector<T>::randomIndex(int left, int right) {
+    static thread_local RandomGenerator rng;
+    unsigned span = static_cast<unsigned>(right - left) + 1u;
+    return left + static_cast<int>(static_cast<unsigned>(rng.getInt()) % span);
+}
+
+template <typename T>
+int PivotSelector<T>::select(const Vector<T>& array, int left, int right, char strategy) {
+    int middle = left + (right - left) / 2;
+
+    switch (strategy) {
+        case 'l':
+            return left;
+        case 'r':
+            return right;
+        case 'x':
+            return randomIndex(left, right);
+        case '3':
+            return medianOfThree(array, left, middle, right);
+        case 'n': {
+            int size = right - left + 1;
+            if (size < nintherThreshold) {
+                return medianOfThree(array, left, middle, right);
+            }
+            int step = size / 8;
+            int a = medianOfThree(array, left, left + step, left + 2 * step);
+            int b = medianOfThree(array, middle - step, middle, middle + step);
+            int c = medianOfThree(array, right - 2 * step, right - step, right);
+            return medianOfThree(array, a, b, c);
+        }
+        case 'm':
+        default:
+            return middle;
+    }
+}
@@ -3,19 +3,48 @@
 
 #include "../../List/List.h"
 #include "../../Vector/Vector.h"
-#include "../../RandomGenerator/RandomGenerator.h"
+#include "../PivotSelector/PivotSelector.h"
+#include "../SortingKernels/SortingKernels.h"
+#include "../../ThreadPool/ThreadPool.h"
+#include "../SortStats/SortStats.h"
 
-template <typename T>
+template <typename T, typename Stats = NoStats>
 class QuickSort {
 public:
-    QuickSort() {}
+    QuickSort() : useKernels(false) {}
     ~QuickSort() {}
 
-    void sort(List<T>& list, char pivot_position = 'm');  // 'l', 'm', 'r', 'x'
+    // Finish ranges of up to SortingKernels::maxBlock elements with a
+    // sorting-network kernel (int, float and double only)
+    void setSmallSortKernels(bool enabled) { useKernels = enabled; }
+
+    void sort(List<T>& list, char pivot_position = 'm');  // 'l', 'm', 'r', 'x', '3', 'n'
+    void sort(Vector<T>& values, char pivot_position = 'm');
+
+    // Dutch-flag variant: keys equal to the pivot are gathered in the middle
+    // and never touched again, so heavy-duplicate inputs cost linear work
+    // per distinct key
+    void sort3Way(Vector<T>& values, char pivot_position = 'm');
+
+    // Sort on a work-stealing pool of 'threads' workers (0 = all cores).
+    // Not available with CountingStats, whose counters are not thread-safe.
+    void sortParallel(Vector<T>& values, char pivot_position = 'm', int threads = 0);
+
+    // Ranges at most this long are sorted sequentially by one worker
+    static constexpr int parallelCutoff = 1 << 14;
+
+    const Stats& getStats() const { return stats; }
 
 private:
+    bool useKernels;
+    Stats stats;
+
+    bool finishedByKernel(Vector<T>& array, int left, int right);
     int partition(Vector<T>& array, int left, int right, char pivot_position);
     void quickSort(Vector<T>& array, int left, int right, char pivot_position);
+    void partition3Way(Vector<T>& array, int left, int right, char pivot_position, int& lessEnd, int& greaterStart);
+    void quickSort3Way(Vector<T>& array, int left, int right, char pivot_position);
+    void quickSortTask(ThreadPool& pool, Vector<T>& array, int left, int right, char pivot_position);
 };
 
 #endif // QUICKSORT_H
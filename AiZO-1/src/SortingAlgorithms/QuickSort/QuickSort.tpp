@@ -1,32 +1,26 @@
-template <typename T>
-int QuickSort<T>::partition(Vector<T>& array, int left, int right, char pivot_position) {
-    T pivot;
-    RandomGenerator rng;
-
-    switch (pivot_position) {
-        case 'l':
-            pivot = array[left];
-            break;
-        case 'm':
-            pivot = array[(left + right) / 2];
-            break;
-        case 'r':
-            pivot = array[right];
-            break;
-        case 'x':
-            pivot = array[rng.getInt() % (right - left + 1) + left];
-            break;
-        default:
-            pivot = array[(left + right) / 2];
-            break;
+template <typename T, typename Stats>
+int QuickSort<T, Stats>::partition(Vector<T>& array, int left, int right, char pivot_position) {
+    // Pivot selection reuses one PRNG per thread instead of seeding a new
+    // generator on every call
+    int pivotIndex = PivotSelector<T>::select(array, left, right, pivot_position);
+
+    // Hoare's scheme never terminates on a pivot taken from the right end
+    // (it can return 'right' and recurse on the same range), so move it left
+    if (pivotIndex == right) {
+        T temp = array[left];
+        array[left] = array[right];
+        array[right] = temp;
+        stats.swap();
+        pivotIndex = left;
     }
+    T pivot = array[pivotIndex];
 
     int l = left - 1;
     int r = right + 1;
 
     while (true) {
-        do { ++l; } while (array[l] < pivot);
-        do { --r; } while (array[r] > pivot);
+        do { ++l; } while (stats.less(array[l], pivot));
+        do { --r; } while (stats.greater(array[r], pivot));
 
         if (l >= r)
             return r;
@@ -35,36 +29,147 @@ int QuickSort<T>::partition(Vector<T>& array, int left, int right, char pivot_po
         T temp = array[l];
         array[l] = array[r];
         array[r] = temp;
+        stats.swap();
     }
 }
 
-template <typename T>
-void QuickSort<T>::quickSort(Vector<T>& array, int left, int right, char pivot_position) {
-    if (left < right) {
+// Hand a small range to the sorting-network kernel when enabled
+template <typename T, typename Stats>
+bool QuickSort<T, Stats>::finishedByKernel(Vector<T>& array, int left, int right) {
+    if constexpr (SmallSortKernel<T>::available) {
+        if (useKernels && right - left + 1 <= SortingKernels::maxBlock) {
+            SmallSortKernel<T>::sort(&array[left], right - left + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::quickSort(Vector<T>& array, int left, int right, char pivot_position) {
+    if (left < right && !finishedByKernel(array, left, right)) {
+        stats.enter();
         int p = partition(array, left, right, pivot_position);
+        stats.partition(p - left + 1, right - p);
         quickSort(array, left, p, pivot_position);
         quickSort(array, p + 1, right, pivot_position);
+        stats.leave();
     }
 }
 
-template <typename T>
-void QuickSort<T>::sort(List<T>& list, char pivot_position) {
-    if (list.getSize() <= 1)
+// Dijkstra's three-way partition: afterwards array[left..lessEnd) < pivot,
+// array[lessEnd..greaterStart] == pivot and array(greaterStart..right] > pivot
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::partition3Way(Vector<T>& array, int left, int right, char pivot_position,
+                                 int& lessEnd, int& greaterStart) {
+    T pivot = array[PivotSelector<T>::select(array, left, right, pivot_position)];
+
+    int lt = left;
+    int i = left;
+    int gt = right;
+
+    while (i <= gt) {
+        if (stats.less(array[i], pivot)) {
+            T temp = array[lt];
+            array[lt++] = array[i];
+            array[i++] = temp;
+            stats.swap();
+        } else if (stats.less(pivot, array[i])) {
+            T temp = array[gt];
+            array[gt--] = array[i];
+            array[i] = temp;
+            stats.swap();
+        } else {
+            ++i;
+        }
+    }
+
+    lessEnd = lt;
+    greaterStart = gt;
+}
+
+// Recurse into the smaller side, loop on the larger one
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::quickSort3Way(Vector<T>& array, int left, int right, char pivot_position) {
+    stats.enter();
+    while (left < right && !finishedByKernel(array, left, right)) {
+        int lessEnd, greaterStart;
+        partition3Way(array, left, right, pivot_position, lessEnd, greaterStart);
+        stats.partition(lessEnd - left, right - greaterStart);
+
+        if (lessEnd - left < right - greaterStart) {
+            quickSort3Way(array, left, lessEnd - 1, pivot_position);
+            left = greaterStart + 1;
+        } else {
+            quickSort3Way(array, greaterStart + 1, right, pivot_position);
+            right = lessEnd - 1;
+        }
+    }
+    stats.leave();
+}
+
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::sort3Way(Vector<T>& values, char pivot_position) {
+    if (values.getSize() <= 1)
         return;
 
-    Vector<T> values;
-    Node<T>* current = list.getList();
-    
-    while (current) {
-        values.pushBack(current->value);
-        current = current->next;
+    quickSort3Way(values, 0, values.getSize() - 1, pivot_position);
+}
+
+// Partition large ranges, hand the left part to the pool and keep going
+// on the right part; small ranges fall back to the sequential recursion
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::quickSortTask(ThreadPool& pool, Vector<T>& array, int left, int right, char pivot_position) {
+    while (right - left + 1 > parallelCutoff) {
+        int p = partition(array, left, right, pivot_position);
+
+        pool.submit([this, &pool, &array, left, p, pivot_position] {
+            quickSortTask(pool, array, left, p, pivot_position);
+        });
+        left = p + 1;
     }
 
+    quickSort(array, left, right, pivot_position);
+}
+
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::sortParallel(Vector<T>& values, char pivot_position, int threads) {
+    static_assert(!Stats::enabled, "CountingStats is not thread-safe, count with sort() instead");
+
+    if (values.getSize() <= 1)
+        return;
+
+    ThreadPool pool(threads > 0 ? threads : ThreadPool::hardwareThreads());
+
+    pool.submit([this, &pool, &values, pivot_position] {
+        quickSortTask(pool, values, 0, values.getSize() - 1, pivot_position);
+    });
+    pool.waitIdle();
+}
+
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::sort(Vector<T>& values, char pivot_position) {
+    if (values.getSize() <= 1)
+        return;
+
     quickSort(values, 0, values.getSize() - 1, pivot_position);
+}
+
+template <typename T, typename Stats>
+void QuickSort<T, Stats>::sort(List<T>& list, char pivot_position) {
+    if (list.getSize() <= 1)
+        return;
 
-    list.clear();
-    
-    for (int i = 0; i < values.getSize(); i++) {
-        list.insertAtTail(values[i]);
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
     }
-}
\ No newline at end of file
+
+    sort(values, pivot_position);
+
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
+    }
+}
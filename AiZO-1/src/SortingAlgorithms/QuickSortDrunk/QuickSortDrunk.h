@@ -4,20 +4,32 @@
 #include "../../List/List.h"
 #include "../../Vector/Vector.h"
 #include "../../RandomGenerator/RandomGenerator.h"
+#include "../../RandomGenerator/BernoulliStream.h"
+#include "../SortStats/SortStats.h"
 
-template <typename T>
+// Each swap decision is skipped with probability drunk / faultScale
+template <typename T, typename Stats = NoStats>
 class QuickSortDrunk {
 public:
-    QuickSortDrunk(int drunk = 0) : drunk(drunk) {}
+    static constexpr long long faultScale = 100000;
+
+    QuickSortDrunk(int drunk = 0) : drunk(drunk), faults(drunk, faultScale, rng) {}
+    // Faults and random pivots from a stream of their own (Monte Carlo trials)
+    QuickSortDrunk(int drunk, uint64_t seed) : drunk(drunk), rng(seed), faults(drunk, faultScale, rng) {}
     ~QuickSortDrunk() {}
 
     void sort(List<T>& list, char pivot_position = 'm');  // 'l', 'm', 'r', 'x'
+    void sort(Vector<T>& values, char pivot_position = 'm');
+
+    const Stats& getStats() const { return stats; }
 
 private:
     int drunk;
     RandomGenerator rng;
+    BernoulliStream faults;
+    Stats stats;
 
-    bool compareWrong();
+    bool compareWrong() { return faults.next(rng); }
 
     int partition(Vector<T>& array, int left, int right, char pivot_position);
     void quickSortDrunk(Vector<T>& array, int left, int right, char pivot_position);
@@ -1,8 +1,8 @@
 #include <cstdlib>
 #include <cmath> 
 
-template <typename T>
-int QuickSortDrunk<T>::partition(Vector<T>& array, int left, int right, char pivot_position) {
+template <typename T, typename Stats>
+int QuickSortDrunk<T, Stats>::partition(Vector<T>& array, int left, int right, char pivot_position) {
     T pivot;
 
     switch (pivot_position) {
@@ -27,8 +27,8 @@ int QuickSortDrunk<T>::partition(Vector<T>& array, int left, int right, char piv
     int r = right;
 
     while (true) {
-        while (array[l] < pivot) ++l;
-        while (array[r] > pivot) --r;
+        while (stats.less(array[l], pivot)) ++l;
+        while (stats.greater(array[r], pivot)) --r;
 
         if (l >= r) {
             return r;
@@ -41,50 +41,49 @@ int QuickSortDrunk<T>::partition(Vector<T>& array, int left, int right, char piv
             T temp = array[l];
             array[l] = array[r];
             array[r] = temp;
+            stats.swap();
             ++l;
             --r;
         }
     }
 }
 
-template <typename T>
-bool QuickSortDrunk<T>::compareWrong() {
-    int raw = rng.getInt();
-    int chance = raw == std::numeric_limits<int>::min()
-                 ? 0
-                 : std::abs(raw) % 100000;
-
-    return chance < drunk;
-}
-
-template <typename T>
-void QuickSortDrunk<T>::quickSortDrunk(Vector<T>& array, int left, int right, char pivot_position) {
+template <typename T, typename Stats>
+void QuickSortDrunk<T, Stats>::quickSortDrunk(Vector<T>& array, int left, int right, char pivot_position) {
     if (left >= right) return;
 
+    stats.enter();
     int m = partition(array, left, right, pivot_position);
+    stats.partition(m - left + 1, right - m);
 
     quickSortDrunk(array, left, m, pivot_position);
     quickSortDrunk(array, m + 1, right, pivot_position);
+    stats.leave();
 }
 
-template <typename T>
-void QuickSortDrunk<T>::sort(List<T>& list, char pivot_position) {
+template <typename T, typename Stats>
+void QuickSortDrunk<T, Stats>::sort(Vector<T>& values, char pivot_position) {
+    if (values.getSize() <= 1)
+        return;
+
+    quickSortDrunk(values, 0, values.getSize() - 1, pivot_position);
+}
+
+template <typename T, typename Stats>
+void QuickSortDrunk<T, Stats>::sort(List<T>& list, char pivot_position) {
     if (list.getSize() <= 1)
         return;
 
-    Vector<T> values;
-    Node<T>* current = list.getList();
-    
-    while (current) {
-        values.pushBack(current->value);
-        current = current->next;
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
     }
 
-    quickSortDrunk(values, 0, values.getSize() - 1, pivot_position);
+    sort(values, pivot_position);
 
-    list.clear();
-    
-    for (int i = 0; i < values.getSize(); i++) {
-        list.insertAtTail(values[i]);
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
     }
 }
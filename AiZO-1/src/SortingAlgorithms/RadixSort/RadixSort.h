@@ -0,0 +1,48 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <cstdint>
+#include <type_traits>
+#include "../../List/List.h"
+#include "../../Vector/Vector.h"
+#include "../CountingSort/CountingSort.h"
+
+// Unsigned integer as wide as T
+template <std::size_t Bytes> struct RadixKeyType;
+template <> struct RadixKeyType<1> { using type = std::uint8_t; };
+template <> struct RadixKeyType<2> { using type = std::uint16_t; };
+template <> struct RadixKeyType<4> { using type = std::uint32_t; };
+template <> struct RadixKeyType<8> { using type = std::uint64_t; };
+
+// Byte-wise LSD radix sort for fixed-width numeric types. Values are mapped
+// to unsigned keys whose natural order matches the order of T:
+//   signed integers - sign bit flipped
+//   floating point  - negatives fully inverted, positives get the sign bit;
+//                     every NaN becomes the largest key, so NaNs end up last
+// 8-bit types need a single pass and go straight to CountingSort.
+template <typename T>
+class RadixSort {
+    static_assert(std::is_arithmetic<T>::value, "RadixSort needs an arithmetic type");
+
+public:
+    using Key = typename RadixKeyType<sizeof(T)>::type;
+
+    RadixSort() {}
+    ~RadixSort() {}
+
+    void sort(List<T>& list);
+    void sort(Vector<T>& values);
+
+    static Key toKey(T value);
+    static T fromKey(Key key);
+
+private:
+    static constexpr int passes = static_cast<int>(sizeof(T));
+    static constexpr Key signBit = static_cast<Key>(Key(1) << (8 * sizeof(T) - 1));
+
+    void radixSort(Vector<T>& values);
+};
+
+#include "RadixSort.tpp"
+
+#endif // RADIXSORT_H
@@ -0,0 +1,123 @@
+#include <cstring>
+#include <limits>
+#include <utility>
+
+template <typename T>
+typename RadixSort<T>::Key RadixSort<T>::toKey(T value) {
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(T));
+
+    if constexpr (std::is_floating_point<T>::value) {
+        if (value != value) {
+            return std::numeric_limits<Key>::max();  // Any NaN, sorted last
+        }
+        return (bits & signBit) ? static_cast<Key>(~bits) : static_cast<Key>(bits | signBit);
+    } else if constexpr (std::is_signed<T>::value) {
+        return static_cast<Key>(bits ^ signBit);
+    } else {
+        return bits;
+    }
+}
+
+template <typename T>
+T RadixSort<T>::fromKey(Key key) {
+    Key bits;
+
+    if constexpr (std::is_floating_point<T>::value) {
+        if (key == std::numeric_limits<Key>::max()) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        bits = (key & signBit) ? static_cast<Key>(key ^ signBit) : static_cast<Key>(~key);
+    } else if constexpr (std::is_signed<T>::value) {
+        bits = static_cast<Key>(key ^ signBit);
+    } else {
+        bits = key;
+    }
+
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void RadixSort<T>::radixSort(Vector<T>& values) {
+    int n = values.getSize();
+
+    Vector<Key> keys(n);
+    Vector<Key> buffer(n);
+    keys.resizeUninitialized(n);
+    buffer.resizeUninitialized(n);
+
+    // One read pass builds the histograms of every byte position
+    int counts[passes][256] = {};
+
+    for (int i = 0; i < n; ++i) {
+        Key key = toKey(values[i]);
+        keys[i] = key;
+        for (int pass = 0; pass < passes; ++pass) {
+            counts[pass][(key >> (8 * pass)) & 0xFF]++;
+        }
+    }
+
+    Key* source = keys.getData();
+    Key* target = buffer.getData();
+
+    for (int pass = 0; pass < passes; ++pass) {
+        int* count = counts[pass];
+
+        // A byte that is the same for every element cannot reorder anything
+        Key sample = (source[0] >> (8 * pass)) & 0xFF;
+        if (count[sample] == n) {
+            continue;
+        }
+
+        int offsets[256];
+        int sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            offsets[b] = sum;
+            sum += count[b];
+        }
+
+        for (int i = 0; i < n; ++i) {
+            Key key = source[i];
+            target[offsets[(key >> (8 * pass)) & 0xFF]++] = key;
+        }
+        std::swap(source, target);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        values[i] = fromKey(source[i]);
+    }
+}
+
+template <typename T>
+void RadixSort<T>::sort(Vector<T>& values) {
+    if (values.getSize() <= 1)
+        return;
+
+    if constexpr (UsesCountingSort<T>::value) {
+        CountingSort<T> counting;
+        counting.sort(values);
+    } else {
+        radixSort(values);
+    }
+}
+
+template <typename T>
+void RadixSort<T>::sort(List<T>& list) {
+    if (list.getSize() <= 1)
+        return;
+
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
+    }
+
+    sort(values);
+
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
+    }
+}
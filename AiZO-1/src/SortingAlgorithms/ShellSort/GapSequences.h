@@ -0,0 +1,119 @@
+#ifndef GAPSEQUENCES_H
+#define GAPSEQUENCES_H
+
+#include <climits>
+
+// Shell sort gap sequences, built at compile time. Each table holds the
+// sequence in ascending order up to INT_MAX; a sort of n elements runs the
+// gaps below n from the largest down to 1.
+struct GapTable {
+    static constexpr int capacity = 400;
+
+    int gaps[capacity];
+    int count;
+};
+
+// 2^k - 1
+constexpr GapTable buildPapernovStasevichGaps() {
+    GapTable table{};
+    for (long long gap = 1; gap <= INT_MAX; gap = 2 * gap + 1) {
+        table.gaps[table.count++] = static_cast<int>(gap);
+    }
+    return table;
+}
+
+// ceil(h_k) with h_1 = 1, h_k = 2.25 h_(k-1) + 1
+constexpr GapTable buildTokudaGaps() {
+    GapTable table{};
+    for (double h = 1.0; h <= INT_MAX; h = 2.25 * h + 1.0) {
+        long long gap = static_cast<long long>(h);
+        table.gaps[table.count++] = static_cast<int>(gap < h ? gap + 1 : gap);
+    }
+    return table;
+}
+
+// Ciura's measured gaps, extended by h_k = floor(2.25 h_(k-1))
+constexpr GapTable buildCiuraGaps() {
+    GapTable table{};
+    const int measured[] = {1, 4, 10, 23, 57, 132, 301, 701};
+    for (int gap : measured) {
+        table.gaps[table.count++] = gap;
+    }
+    for (long long gap = 701LL * 9 / 4; gap <= INT_MAX; gap = gap * 9 / 4) {
+        table.gaps[table.count++] = static_cast<int>(gap);
+    }
+    return table;
+}
+
+// Sedgewick 1986: 1, then 4^k + 3 * 2^(k-1) + 1
+constexpr GapTable buildSedgewickGaps() {
+    GapTable table{};
+    table.gaps[table.count++] = 1;
+    for (long long k = 1, gap = 8; gap <= INT_MAX; ++k, gap = (1LL << (2 * k)) + 3 * (1LL << (k - 1)) + 1) {
+        table.gaps[table.count++] = static_cast<int>(gap);
+    }
+    return table;
+}
+
+// Pratt: every 2^p 3^q, merged in ascending order
+constexpr GapTable buildPrattGaps() {
+    GapTable table{};
+    table.gaps[table.count++] = 1;
+    int twice = 0, thrice = 0;
+    while (true) {
+        long long byTwo = 2LL * table.gaps[twice];
+        long long byThree = 3LL * table.gaps[thrice];
+        long long gap = byTwo < byThree ? byTwo : byThree;
+        if (gap > INT_MAX)
+            break;
+        table.gaps[table.count++] = static_cast<int>(gap);
+        if (gap == byTwo) ++twice;
+        if (gap == byThree) ++thrice;
+    }
+    return table;
+}
+
+class GapSequences {
+public:
+    // Selector values of ShellSort::sort; 1 and 2 keep their old meaning
+    enum Sequence { PapernovStasevich = 1, Tokuda = 2, Ciura = 3, Sedgewick = 4, Pratt = 5 };
+
+    static constexpr bool isValid(int sequence) { return sequence >= PapernovStasevich && sequence <= Pratt; }
+
+    // Index of the largest gap below n (0 when n <= 1)
+    static constexpr int firstIndex(const GapTable& table, long long n) {
+        int index = 0;
+        while (index + 1 < table.count && table.gaps[index + 1] < n) ++index;
+        return index;
+    }
+
+    static constexpr const GapTable& table(int sequence) {
+        switch (sequence) {
+            case Tokuda: return tokuda;
+            case Ciura: return ciura;
+            case Sedgewick: return sedgewick;
+            case Pratt: return pratt;
+            default: return papernovStasevich;
+        }
+    }
+
+    static const char* name(int sequence) {
+        switch (sequence) {
+            case PapernovStasevich: return "papernov";
+            case Tokuda: return "tokuda";
+            case Ciura: return "ciura";
+            case Sedgewick: return "sedgewick";
+            case Pratt: return "pratt";
+            default: return "unknown";
+        }
+    }
+
+private:
+    static constexpr GapTable papernovStasevich = buildPapernovStasevichGaps();
+    static constexpr GapTable tokuda = buildTokudaGaps();
+    static constexpr GapTable ciura = buildCiuraGaps();
+    static constexpr GapTable sedgewick = buildSedgewickGaps();
+    static constexpr GapTable pratt = buildPrattGaps();
+};
+
+#endif // GAPSEQUENCES_H
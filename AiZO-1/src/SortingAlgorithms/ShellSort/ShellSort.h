@@ -3,19 +3,47 @@
 
 #include "../../List/List.h"
 #include "../../Vector/Vector.h"
-#include <cmath>
+#include "../SortingKernels/SortingKernels.h"
+#include "../SortStats/SortStats.h"
+#include "GapSequences.h"
 
-template<typename T>
+template<typename T, typename Stats = NoStats>
 class ShellSort {
 public:
-    ShellSort() {}
+    // Chains that share one cache line, advanced together by the interleaved pass
+    static constexpr int chainsPerBlock = sizeof(T) < 64 ? static_cast<int>(64 / sizeof(T)) : 1;
+    static constexpr long long defaultInterleaveBytes = 2LL << 20;
+
+    // Fastest sequence per type on the --bench grid (random input, 10^4..10^6):
+    // Sedgewick for int/float/double, Ciura for char
+    static constexpr int fastestGaps = sizeof(T) == 1 ? GapSequences::Ciura : GapSequences::Sedgewick;
+
+    ShellSort() : useKernels(false), interleaveBytes(defaultInterleaveBytes) {}
     ~ShellSort() {}
 
-    void sort(List<T>& list, int space_selector = 1); // 1: Papernov-Stasevich, 2: Tokuda
+    // Sort inputs of up to SortingKernels::maxBlock elements with a
+    // sorting-network kernel instead of gap passes (int, float, double)
+    void setSmallSortKernels(bool enabled) { useKernels = enabled; }
+
+    // Gaps from larger than this many bytes run their h-chains in
+    // interleaved blocks (0 = always, -1 = never)
+    void setInterleaveBytes(long long bytes) { interleaveBytes = bytes; }
+
+    // space_selector is a GapSequences::Sequence: 1 Papernov-Stasevich,
+    // 2 Tokuda, 3 Ciura, 4 Sedgewick, 5 Pratt
+    void sort(List<T>& list, int space_selector = 1);
+    void sort(Vector<T>& values, int space_selector = 1);
+
+    const Stats& getStats() const { return stats; }
 
 private:
-    int calculateK0(int size, int space_selector) const;
-    int calculateGap(int k, int space_selector) const;
+    bool useKernels;
+    long long interleaveBytes;
+    Stats stats;
+
+    void insert(T* data, int i, int gap);
+    void gapPass(T* data, int n, int gap);
+    void interleavedGapPass(T* data, int n, int gap);
     void shellSort(Vector<T>& data, int space_selector);
 };
 
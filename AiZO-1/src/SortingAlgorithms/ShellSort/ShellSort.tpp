@@ -1,68 +1,87 @@
-template<typename T>
-int ShellSort<T>::calculateK0(int size, int space_selector) const {
-    int k = 0;
-    switch (space_selector) {
-        case 1:
-            while ((pow(2, k) - 1) < size) ++k;
-            return --k;
-        case 2:
-            while (ceil(1.8 * pow(2.25, k - 1) - 0.8) < size) ++k;
-            return --k;
-        default:
-            return 0;
+// Insertion step of one h-chain: move data[i] back past larger elements gap apart
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::insert(T* data, int i, int gap) {
+    T temp = data[i];
+    int j = i;
+    while (j >= gap && stats.greater(data[j - gap], temp)) {
+        data[j] = data[j - gap];
+        stats.move();
+        j -= gap;
     }
+    data[j] = temp;
 }
 
-template<typename T>
-int ShellSort<T>::calculateGap(int k, int space_selector) const {
-    switch (space_selector) {
-        case 1:
-            return static_cast<int>(pow(2, k) - 1); // Papernov-Stasevich
-        case 2:
-            return static_cast<int>(ceil(1.8 * pow(2.25, k - 1) - 0.8)); // Tokuda
-        default:
-            return 1;
+// Row by row: element i advances chain i % gap
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::gapPass(T* data, int n, int gap) {
+    for (int i = gap; i < n; i++) {
+        insert(data, i, gap);
     }
 }
 
-template<typename T>
-void ShellSort<T>::shellSort(Vector<T>& data, int space_selector) {
+// Chains in blocks of chainsPerBlock: the block walks down its column of
+// the array, so each row step touches one cache line that the next row's
+// insertions find still cached. Row by row, a large gap evicts that line
+// before the chain comes back to it.
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::interleavedGapPass(T* data, int n, int gap) {
+    for (int first = 0; first < gap; first += chainsPerBlock) {
+        int width = gap - first < chainsPerBlock ? gap - first : chainsPerBlock;
+        for (long long row = static_cast<long long>(first) + gap; row < n; row += gap) {
+            int end = row + width < n ? static_cast<int>(row + width) : n;
+            if (row + 2 * gap < n) __builtin_prefetch(data + row + 2 * gap, 1);
+            for (int i = static_cast<int>(row); i < end; i++) {
+                insert(data, i, gap);
+            }
+        }
+    }
+}
+
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::shellSort(Vector<T>& data, int space_selector) {
+    const GapTable& table = GapSequences::table(space_selector);
     int N = data.getSize();
-    int k = calculateK0(N, space_selector);
-    int gap = calculateGap(k--, space_selector);
 
-    while (k >= 0) {
-        for (int i = gap; i < N; i++) {
-            T temp = data[i];
-            int j = i;
-            while (j >= gap && data[j - gap] > temp) {
-                data[j] = data[j - gap];
-                j -= gap;
-            }
-            data[j] = temp;
+    for (int k = GapSequences::firstIndex(table, N); k >= 0; --k) {
+        int gap = table.gaps[k];
+        if (interleaveBytes >= 0 && static_cast<long long>(gap) * static_cast<long long>(sizeof(T)) > interleaveBytes) {
+            interleavedGapPass(data.getData(), N, gap);
+        } else {
+            gapPass(data.getData(), N, gap);
         }
-        gap = calculateGap(k--, space_selector);
     }
 }
 
-template<typename T>
-void ShellSort<T>::sort(List<T>& list, int space_selector) {
-    if (list.getSize() <= 1)
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::sort(Vector<T>& values, int space_selector) {
+    if (values.getSize() <= 1)
         return;
 
-    Vector<T> values;
-    Node<T>* current = list.getList();
-    
-    while (current) {
-        values.pushBack(current->value);
-        current = current->next;
+    if constexpr (SmallSortKernel<T>::available) {
+        if (useKernels && values.getSize() <= SortingKernels::maxBlock) {
+            SmallSortKernel<T>::sort(values.getData(), values.getSize());
+            return;
+        }
     }
 
     shellSort(values, space_selector);
+}
+
+template<typename T, typename Stats>
+void ShellSort<T, Stats>::sort(List<T>& list, int space_selector) {
+    if (list.getSize() <= 1)
+        return;
 
-    list.clear();
-    
-    for (int i = 0; i < values.getSize(); i++) {
-        list.insertAtTail(values[i]);
+    Vector<T> values(list.getSize());
+    for (const T& value : list.view()) {
+        values.pushBack(value);
     }
-}
\ No newline at end of file
+
+    sort(values, space_selector);
+
+    // Write the sorted values back into the existing nodes
+    int i = 0;
+    for (T& value : list.view()) {
+        value = values[i++];
+    }
+}
@@ -0,0 +1,36 @@
+#include "SortStats.h"
+
+#include <cstdio>
+
+void CountingStats::partition(long long left, long long right) {
+    ++partitions;
+    if (left + right > 0) {
+        double imbalance = static_cast<double>(left > right ? left - right : right - left) / (left + right);
+        imbalanceSum += imbalance;
+        if (imbalance > maxImbalance) maxImbalance = imbalance;
+    }
+}
+
+void CountingStats::print(std::ostream& out) const {
+    char imbalance[64];
+    std::snprintf(imbalance, sizeof(imbalance), "%.3f mean, %.3f worst", getMeanImbalance(), maxImbalance);
+
+    out << "Comparisons: " << comparisons << "\n"
+        << "Swaps: " << swaps << "\n"
+        << "Moves: " << moves << "\n"
+        << "Max depth: " << maxDepth << "\n";
+    if (partitions > 0) {
+        out << "Partitions: " << partitions << " (imbalance " << imbalance << ")\n";
+    }
+}
+
+std::string CountingStats::csvValues() const {
+    char row[160];
+    std::snprintf(row, sizeof(row), "%lld;%lld;%lld;%d;%lld;%.4f;%.4f", comparisons, swaps, moves, maxDepth,
+                  partitions, getMeanImbalance(), maxImbalance);
+    return row;
+}
+
+std::string CountingStats::csvHeader() {
+    return "comparisons;swaps;moves;max_depth;partitions;mean_imbalance;max_imbalance";
+}
@@ -0,0 +1,74 @@
+#ifndef SORTSTATS_H
+#define SORTSTATS_H
+
+#include <ostream>
+#include <string>
+
+// Instrumentation policies for QuickSort, QuickSortDrunk, HeapSort, ShellSort
+// and InsertionSort (their second template parameter). The sorters route
+// every key comparison through less()/greater() and report swaps, shifts,
+// recursion and partition sizes through the other hooks.
+//
+// NoStats is the default: its hooks are empty inline functions, so the
+// instrumented sorters compile to the same code as before. CountingStats
+// records the counts; it is not thread-safe, so QuickSort::sortParallel
+// refuses it. Comparisons made by PivotSelector and by the sorting-network
+// kernels (--kernels) are not counted.
+struct NoStats {
+    static constexpr bool enabled = false;
+
+    template <typename A, typename B>
+    bool less(const A& a, const B& b) { return a < b; }
+    template <typename A, typename B>
+    bool greater(const A& a, const B& b) { return a > b; }
+
+    void swap() {}
+    void move() {}
+    void move(long long) {}
+    void enter() {}
+    void leave() {}
+    void partition(long long, long long) {}
+};
+
+struct CountingStats {
+    static constexpr bool enabled = true;
+
+    long long comparisons = 0;
+    long long swaps = 0;
+    long long moves = 0;       // single-element shifts (insertion, shell)
+    int depth = 0;
+    int maxDepth = 0;          // deepest recursion (quick) or sift-down chain (heap)
+    long long partitions = 0;
+    double imbalanceSum = 0.0; // per partition: |left - right| / (left + right)
+    double maxImbalance = 0.0;
+
+    template <typename A, typename B>
+    bool less(const A& a, const B& b) {
+        ++comparisons;
+        return a < b;
+    }
+    template <typename A, typename B>
+    bool greater(const A& a, const B& b) {
+        ++comparisons;
+        return a > b;
+    }
+
+    void swap() { ++swaps; }
+    void move() { ++moves; }
+    void move(long long count) { moves += count; }  // block shift of 'count' elements
+    void enter() {
+        if (++depth > maxDepth) maxDepth = depth;
+    }
+    void leave() { --depth; }
+    void partition(long long left, long long right);
+
+    double getMeanImbalance() const { return partitions > 0 ? imbalanceSum / partitions : 0.0; }
+
+    void print(std::ostream& out) const;
+
+    // ';'-separated, in csvHeader() order
+    std::string csvValues() const;
+    static std::string csvHeader();
+};
+
+#endif // SORTSTATS_H
@@ -0,0 +1,144 @@
+#ifndef BITONICNETWORK_H
+#define BITONICNETWORK_H
+
+// Register-level bitonic sorting network, shared by the SIMD translation
+// units. V is a register traits type providing:
+//   Reg, Scalar, width            - vector type, lane type, lanes per Reg
+//   load/store/min/max            - unaligned memory access and lane-wise min/max
+//   exchange<M>(r)                - lane i receives lane i ^ M
+//   select<Bit>(lo, hi)           - lanes with (i & Bit) != 0 take hi
+//
+// Every merge stage K first compares i with i ^ (K - 1) ("flip") and then
+// runs half-cleaners at distances K/4 ... 1, all in ascending direction.
+// Distances of at least one register work on whole registers; shorter ones
+// shuffle lanes inside a register.
+
+template <class V>
+inline typename V::Reg reverseRegister(typename V::Reg r) {
+    return V::template exchange<V::width - 1>(r);
+}
+
+template <class V, int K>
+inline typename V::Reg flipInRegister(typename V::Reg r) {
+    typename V::Reg other = V::template exchange<K - 1>(r);
+    return V::template select<K / 2>(V::min(r, other), V::max(r, other));
+}
+
+template <class V, int J>
+inline typename V::Reg halfCleanInRegister(typename V::Reg r) {
+    typename V::Reg other = V::template exchange<J>(r);
+    return V::template select<J>(V::min(r, other), V::max(r, other));
+}
+
+template <class V, int B, int J>
+inline void halfCleanSteps(typename V::Reg* r) {
+    if constexpr (J >= 1) {
+        constexpr int W = V::width;
+        constexpr int R = B / W;
+
+        if constexpr (J >= W) {
+            constexpr int D = J / W;
+            for (int p = 0; p < R; ++p) {
+                if ((p & D) == 0) {
+                    typename V::Reg lo = V::min(r[p], r[p + D]);
+                    r[p + D] = V::max(r[p], r[p + D]);
+                    r[p] = lo;
+                }
+            }
+        } else {
+            for (int p = 0; p < R; ++p) {
+                r[p] = halfCleanInRegister<V, J>(r[p]);
+            }
+        }
+
+        halfCleanSteps<V, B, J / 2>(r);
+    }
+}
+
+template <class V, int B, int K>
+inline void flipStep(typename V::Reg* r) {
+    constexpr int W = V::width;
+    constexpr int R = B / W;
+
+    if constexpr (K <= W) {
+        for (int p = 0; p < R; ++p) {
+            r[p] = flipInRegister<V, K>(r[p]);
+        }
+    } else {
+        constexpr int regsPerBlock = K / W;
+        for (int block = 0; block < R; block += regsPerBlock) {
+            for (int p = 0; p < regsPerBlock / 2; ++p) {
+                int a = block + p;
+                int b = block + regsPerBlock - 1 - p;
+                typename V::Reg mirrored = reverseRegister<V>(r[b]);
+                typename V::Reg lo = V::min(r[a], mirrored);
+                typename V::Reg hi = V::max(r[a], mirrored);
+                r[a] = lo;
+                r[b] = reverseRegister<V>(hi);
+            }
+        }
+    }
+}
+
+template <class V, int B, int K>
+inline void mergeStages(typename V::Reg* r) {
+    flipStep<V, B, K>(r);
+    halfCleanSteps<V, B, K / 4>(r);
+
+    if constexpr (K < B) {
+        mergeStages<V, B, 2 * K>(r);
+    }
+}
+
+// Sort exactly B contiguous values in place
+template <class V, int B>
+inline void bitonicSortBlock(typename V::Scalar* data) {
+    static_assert(B % V::width == 0, "block must fill whole registers");
+    constexpr int R = B / V::width;
+
+    typename V::Reg r[R];
+    for (int p = 0; p < R; ++p) {
+        r[p] = V::load(data + p * V::width);
+    }
+
+    mergeStages<V, B, 2>(r);
+
+    for (int p = 0; p < R; ++p) {
+        V::store(data + p * V::width, r[p]);
+    }
+}
+
+// Dispatch a runtime block size to the matching instantiation
+template <class V>
+inline void bitonicSortBlock(typename V::Scalar* data, int blockSize) {
+    switch (blockSize) {
+        case 2:  if constexpr (V::width <= 2) bitonicSortBlock<V, 2>(data); break;
+        case 4:  if constexpr (V::width <= 4) bitonicSortBlock<V, 4>(data); break;
+        case 8:  if constexpr (V::width <= 8) bitonicSortBlock<V, 8>(data); break;
+        case 16: bitonicSortBlock<V, 16>(data); break;
+        case 32: bitonicSortBlock<V, 32>(data); break;
+        default: break;
+    }
+}
+
+// Lane permutation immediates: lane i takes lane i ^ M
+constexpr int exchangeImmediate2Bit(int m, int lanes) {
+    int imm = 0;
+    for (int i = 0; i < lanes; ++i) {
+        imm |= (i ^ m) << (2 * i);
+    }
+    return imm;
+}
+
+// Blend immediates: lane i is set when (i & bit) != 0, each lane 'bitsPerLane' wide
+constexpr int selectImmediate(int bit, int lanes, int bitsPerLane) {
+    int imm = 0;
+    for (int i = 0; i < lanes; ++i) {
+        if (i & bit) {
+            imm |= ((1 << bitsPerLane) - 1) << (i * bitsPerLane);
+        }
+    }
+    return imm;
+}
+
+#endif // BITONICNETWORK_H
@@ -0,0 +1,222 @@
+#include "SortingKernels.h"
+#include "SortingKernelsIsa.h"
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+// Branchless compare-exchange. Floating point maps onto minss/maxss via
+// std::min/max; integers need the shared condition to become two cmovs.
+template <typename T>
+inline void compareExchange(T& a, T& b) {
+    if constexpr (std::is_floating_point<T>::value) {
+        T lo = std::min(a, b);
+        T hi = std::max(a, b);
+        a = lo;
+        b = hi;
+    } else {
+        bool swap = b < a;
+        T lo = swap ? b : a;
+        T hi = swap ? a : b;
+        a = lo;
+        b = hi;
+    }
+}
+
+// Same bitonic network as the SIMD kernels, one comparator at a time.
+// B is a template parameter so the compiler can unroll every stage.
+template <typename T, int B>
+void sortNetworkScalar(T* data) {
+    for (int k = 2; k <= B; k *= 2) {
+#pragma GCC unroll 32
+        for (int i = 0; i < B; ++i) {
+            int partner = i ^ (k - 1);
+            if (partner > i) compareExchange(data[i], data[partner]);
+        }
+        for (int j = k / 4; j >= 1; j /= 2) {
+#pragma GCC unroll 32
+            for (int i = 0; i < B; ++i) {
+                int partner = i ^ j;
+                if (partner > i) compareExchange(data[i], data[partner]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void sortNetworkScalar(T* data, int blockSize) {
+    switch (blockSize) {
+        case 2:  sortNetworkScalar<T, 2>(data); break;
+        case 4:  sortNetworkScalar<T, 4>(data); break;
+        case 8:  sortNetworkScalar<T, 8>(data); break;
+        case 16: sortNetworkScalar<T, 16>(data); break;
+        case 32: sortNetworkScalar<T, 32>(data); break;
+        default: break;
+    }
+}
+
+template <typename T>
+void insertionSort(T* data, int n) {
+    for (int i = 1; i < n; ++i) {
+        T key = data[i];
+        int j = i - 1;
+        while (j >= 0 && data[j] > key) {
+            data[j + 1] = data[j];
+            j--;
+        }
+        data[j + 1] = key;
+    }
+}
+
+// Value that sorts after every real input, used to pad short blocks
+template <typename T>
+constexpr T paddingValue() {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::max();
+    }
+}
+
+// CPUID check, only meaningful when the kernel was compiled in
+bool cpuSupports(SortingKernels::Isa isa) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    switch (isa) {
+        case SortingKernels::Isa::Avx2: return avx2KernelsCompiled() && __builtin_cpu_supports("avx2");
+        case SortingKernels::Isa::Sse4: return sse4KernelsCompiled() && __builtin_cpu_supports("sse4.1");
+        case SortingKernels::Isa::Scalar: return true;
+    }
+    return false;
+#else
+    return isa == SortingKernels::Isa::Scalar;
+#endif
+}
+
+SortingKernels::Isa detectIsa() {
+    if (cpuSupports(SortingKernels::Isa::Avx2)) {
+        return SortingKernels::Isa::Avx2;
+    }
+    if (cpuSupports(SortingKernels::Isa::Sse4)) {
+        return SortingKernels::Isa::Sse4;
+    }
+    return SortingKernels::Isa::Scalar;
+}
+
+// Narrowest block an instruction set can sort for T
+template <typename T>
+int minimumBlock(SortingKernels::Isa isa) {
+    int lanes = 0;
+    switch (isa) {
+        case SortingKernels::Isa::Avx2: lanes = static_cast<int>(32 / sizeof(T)); break;
+        case SortingKernels::Isa::Sse4: lanes = static_cast<int>(16 / sizeof(T)); break;
+        case SortingKernels::Isa::Scalar: lanes = 2; break;
+    }
+    return std::max(lanes, 2);
+}
+
+template <typename T>
+void runNetwork(T* data, int blockSize, SortingKernels::Isa isa) {
+    switch (isa) {
+        case SortingKernels::Isa::Avx2: sortNetworkAvx2(data, blockSize); break;
+        case SortingKernels::Isa::Sse4: sortNetworkSse4(data, blockSize); break;
+        case SortingKernels::Isa::Scalar: sortNetworkScalar(data, blockSize); break;
+    }
+}
+
+template <typename T>
+void sortSmallImpl(T* data, int n, SortingKernels::Isa isa) {
+    if (n <= 1)
+        return;
+
+    if (n > SortingKernels::maxBlock) {
+        insertionSort(data, n);
+        return;
+    }
+
+    if constexpr (std::is_floating_point<T>::value) {
+        for (int i = 0; i < n; ++i) {
+            if (data[i] != data[i]) {
+                insertionSort(data, n);
+                return;
+            }
+        }
+    }
+
+    // A block that fits one SSE register is not worth padding to AVX2 width
+    if (isa == SortingKernels::Isa::Avx2 && n <= minimumBlock<T>(SortingKernels::Isa::Sse4)
+        && SortingKernels::supports(SortingKernels::Isa::Sse4)) {
+        isa = SortingKernels::Isa::Sse4;
+    }
+
+    int blockSize = minimumBlock<T>(isa);
+    while (blockSize < n) {
+        blockSize *= 2;
+    }
+
+    if (blockSize == n) {
+        runNetwork(data, blockSize, isa);
+        return;
+    }
+
+    alignas(32) T padded[SortingKernels::maxBlock];
+    std::copy(data, data + n, padded);
+    std::fill(padded + n, padded + blockSize, paddingValue<T>());
+
+    runNetwork(padded, blockSize, isa);
+    std::copy(padded, padded + n, data);
+}
+
+} // namespace
+
+void SortingKernels::sortSmall(int* data, int n) {
+    sortSmallImpl(data, n, activeIsa());
+}
+
+void SortingKernels::sortSmall(float* data, int n) {
+    sortSmallImpl(data, n, activeIsa());
+}
+
+void SortingKernels::sortSmall(double* data, int n) {
+    sortSmallImpl(data, n, activeIsa());
+}
+
+void SortingKernels::sortSmall(int* data, int n, Isa isa) {
+    sortSmallImpl(data, n, supports(isa) ? isa : Isa::Scalar);
+}
+
+void SortingKernels::sortSmall(float* data, int n, Isa isa) {
+    sortSmallImpl(data, n, supports(isa) ? isa : Isa::Scalar);
+}
+
+void SortingKernels::sortSmall(double* data, int n, Isa isa) {
+    sortSmallImpl(data, n, supports(isa) ? isa : Isa::Scalar);
+}
+
+// Detected once, on first use
+SortingKernels::Isa SortingKernels::activeIsa() {
+    static const Isa isa = detectIsa();
+    return isa;
+}
+
+bool SortingKernels::supports(Isa isa) {
+    static const bool avx2 = cpuSupports(Isa::Avx2);
+    static const bool sse4 = cpuSupports(Isa::Sse4);
+
+    switch (isa) {
+        case Isa::Avx2: return avx2;
+        case Isa::Sse4: return sse4;
+        case Isa::Scalar: return true;
+    }
+    return false;
+}
+
+const char* SortingKernels::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::Avx2: return "avx2";
+        case Isa::Sse4: return "sse4.1";
+        case Isa::Scalar: return "scalar";
+    }
+    return "unknown";
+}
@@ -0,0 +1,57 @@
+#ifndef SORTINGKERNELS_H
+#define SORTINGKERNELS_H
+
+// Sorting-network kernels for small blocks (up to 32 elements) of int,
+// float and double. The instruction set is picked once at runtime from
+// CPUID: AVX2, then SSE4.1, then a branchless scalar network.
+class SortingKernels {
+public:
+    enum class Isa { Scalar, Sse4, Avx2 };
+
+    // Largest block a kernel sorts in one go
+    static constexpr int maxBlock = 32;
+
+    // Sort data[0..n) for n <= maxBlock. Shorter blocks are padded to the
+    // next network size internally. Floating point blocks holding a NaN
+    // are insertion sorted instead, since SIMD min/max are not NaN-safe.
+    static void sortSmall(int* data, int n);
+    static void sortSmall(float* data, int n);
+    static void sortSmall(double* data, int n);
+
+    // Same, with an explicit instruction set (for benchmarks)
+    static void sortSmall(int* data, int n, Isa isa);
+    static void sortSmall(float* data, int n, Isa isa);
+    static void sortSmall(double* data, int n, Isa isa);
+
+    static Isa activeIsa();
+    static bool supports(Isa isa);
+    static const char* isaName(Isa isa);
+};
+
+// Compile-time hook for generic sorters: SmallSortKernel<T>::available is
+// true when sortSmall has an overload for T
+template <typename T>
+struct SmallSortKernel {
+    static constexpr bool available = false;
+    static void sort(T*, int) {}
+};
+
+template <>
+struct SmallSortKernel<int> {
+    static constexpr bool available = true;
+    static void sort(int* data, int n) { SortingKernels::sortSmall(data, n); }
+};
+
+template <>
+struct SmallSortKernel<float> {
+    static constexpr bool available = true;
+    static void sort(float* data, int n) { SortingKernels::sortSmall(data, n); }
+};
+
+template <>
+struct SmallSortKernel<double> {
+    static constexpr bool available = true;
+    static void sort(double* data, int n) { SortingKernels::sortSmall(data, n); }
+};
+
+#endif // SORTINGKERNELS_H
@@ -0,0 +1,95 @@
+#include "SortingKernelsIsa.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+#include "BitonicNetwork.h"
+
+namespace {
+
+struct Avx2Int {
+    using Reg = __m256i;
+    using Scalar = int;
+    static constexpr int width = 8;
+
+    static Reg load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(int* p, Reg r) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_epi32(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_epi32(a, b); }
+
+    template <int M>
+    static Reg exchange(Reg r) {
+        const __m256i index = _mm256_setr_epi32(0 ^ M, 1 ^ M, 2 ^ M, 3 ^ M, 4 ^ M, 5 ^ M, 6 ^ M, 7 ^ M);
+        return _mm256_permutevar8x32_epi32(r, index);
+    }
+
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm256_blend_epi32(lo, hi, selectImmediate(Bit, 8, 1)); }
+};
+
+struct Avx2Float {
+    using Reg = __m256;
+    using Scalar = float;
+    static constexpr int width = 8;
+
+    static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm256_storeu_ps(p, r); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+
+    template <int M>
+    static Reg exchange(Reg r) {
+        const __m256i index = _mm256_setr_epi32(0 ^ M, 1 ^ M, 2 ^ M, 3 ^ M, 4 ^ M, 5 ^ M, 6 ^ M, 7 ^ M);
+        return _mm256_permutevar8x32_ps(r, index);
+    }
+
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm256_blend_ps(lo, hi, selectImmediate(Bit, 8, 1)); }
+};
+
+struct Avx2Double {
+    using Reg = __m256d;
+    using Scalar = double;
+    static constexpr int width = 4;
+
+    static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, Reg r) { _mm256_storeu_pd(p, r); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+
+    template <int M>
+    static Reg exchange(Reg r) { return _mm256_permute4x64_pd(r, exchangeImmediate2Bit(M, 4)); }
+
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm256_blend_pd(lo, hi, selectImmediate(Bit, 4, 1)); }
+};
+
+} // namespace
+
+bool avx2KernelsCompiled() {
+    return true;
+}
+
+void sortNetworkAvx2(int* data, int blockSize) {
+    bitonicSortBlock<Avx2Int>(data, blockSize);
+}
+
+void sortNetworkAvx2(float* data, int blockSize) {
+    bitonicSortBlock<Avx2Float>(data, blockSize);
+}
+
+void sortNetworkAvx2(double* data, int blockSize) {
+    bitonicSortBlock<Avx2Double>(data, blockSize);
+}
+
+#else // Built without -mavx2: report the kernels as missing
+
+bool avx2KernelsCompiled() {
+    return false;
+}
+
+void sortNetworkAvx2(int*, int) {}
+void sortNetworkAvx2(float*, int) {}
+void sortNetworkAvx2(double*, int) {}
+
+#endif
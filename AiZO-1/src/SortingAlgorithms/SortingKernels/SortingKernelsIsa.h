@@ -0,0 +1,18 @@
+#ifndef SORTINGKERNELSISA_H
+#define SORTINGKERNELSISA_H
+
+// Per-instruction-set entry points, each defined in a translation unit
+// compiled with the matching -m flags. blockSize is a power of two between
+// the register width and SortingKernels::maxBlock.
+
+bool avx2KernelsCompiled();
+void sortNetworkAvx2(int* data, int blockSize);
+void sortNetworkAvx2(float* data, int blockSize);
+void sortNetworkAvx2(double* data, int blockSize);
+
+bool sse4KernelsCompiled();
+void sortNetworkSse4(int* data, int blockSize);
+void sortNetworkSse4(float* data, int blockSize);
+void sortNetworkSse4(double* data, int blockSize);
+
+#endif // SORTINGKERNELSISA_H
@@ -0,0 +1,91 @@
+#include "SortingKernelsIsa.h"
+
+#if defined(__SSE4_1__)
+
+#include <smmintrin.h>
+#include "BitonicNetwork.h"
+
+namespace {
+
+struct Sse4Int {
+    using Reg = __m128i;
+    using Scalar = int;
+    static constexpr int width = 4;
+
+    static Reg load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(int* p, Reg r) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r); }
+    static Reg min(Reg a, Reg b) { return _mm_min_epi32(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_epi32(a, b); }
+
+    template <int M>
+    static Reg exchange(Reg r) { return _mm_shuffle_epi32(r, exchangeImmediate2Bit(M, 4)); }
+
+    // 16-bit blend: every 32-bit lane is two bits of the immediate
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm_blend_epi16(lo, hi, selectImmediate(Bit, 4, 2)); }
+};
+
+struct Sse4Float {
+    using Reg = __m128;
+    using Scalar = float;
+    static constexpr int width = 4;
+
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm_storeu_ps(p, r); }
+    static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+
+    template <int M>
+    static Reg exchange(Reg r) { return _mm_shuffle_ps(r, r, exchangeImmediate2Bit(M, 4)); }
+
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm_blend_ps(lo, hi, selectImmediate(Bit, 4, 1)); }
+};
+
+struct Sse4Double {
+    using Reg = __m128d;
+    using Scalar = double;
+    static constexpr int width = 2;
+
+    static Reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, Reg r) { _mm_storeu_pd(p, r); }
+    static Reg min(Reg a, Reg b) { return _mm_min_pd(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_pd(a, b); }
+
+    // Only M == 1 exists with two lanes: swap them
+    template <int M>
+    static Reg exchange(Reg r) { return _mm_shuffle_pd(r, r, M == 1 ? 1 : 2); }
+
+    template <int Bit>
+    static Reg select(Reg lo, Reg hi) { return _mm_blend_pd(lo, hi, selectImmediate(Bit, 2, 1)); }
+};
+
+} // namespace
+
+bool sse4KernelsCompiled() {
+    return true;
+}
+
+void sortNetworkSse4(int* data, int blockSize) {
+    bitonicSortBlock<Sse4Int>(data, blockSize);
+}
+
+void sortNetworkSse4(float* data, int blockSize) {
+    bitonicSortBlock<Sse4Float>(data, blockSize);
+}
+
+void sortNetworkSse4(double* data, int blockSize) {
+    bitonicSortBlock<Sse4Double>(data, blockSize);
+}
+
+#else // Built without -msse4.1: report the kernels as missing
+
+bool sse4KernelsCompiled() {
+    return false;
+}
+
+void sortNetworkSse4(int*, int) {}
+void sortNetworkSse4(float*, int) {}
+void sortNetworkSse4(double*, int) {}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef SORTINGNETWORK_H
+#define SORTINGNETWORK_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// One compare-exchange: afterwards values[low] <= values[high]
+struct Comparator {
+    int low;
+    int high;
+};
+
+// Fixed-size sorting network built entirely at compile time. N <= 8 use
+// the size-optimal networks (Knuth, TAOCP 5.3.4); larger N use Batcher's
+// merge-exchange network, which works for any N. The comparator sequence
+// is expanded into straight-line, branchless min/max code and everything
+// is constexpr, so it also sorts inside constant expressions.
+template <std::size_t N, typename T>
+class SortingNetwork {
+public:
+    static constexpr std::size_t comparatorCount();
+    static constexpr auto comparators();
+
+    static constexpr void sort(std::array<T, N>& values);
+    static constexpr void sort(T* values);
+
+    // Check the network with the 0-1 principle (2^N inputs, so keep N small)
+    static constexpr bool sortsAllZeroOneInputs();
+
+private:
+    template <std::size_t... I>
+    static constexpr void apply(T* values, std::index_sequence<I...>);
+
+    static constexpr void compareExchange(T& a, T& b);
+};
+
+#include "SortingNetwork.tpp"
+
+#endif // SORTINGNETWORK_H
@@ -0,0 +1,138 @@
+// Size-optimal networks for 2..8 inputs (1, 3, 5, 9, 12, 16, 19 comparators)
+namespace SortingNetworkTables {
+
+constexpr Comparator optimal2[] = {{0, 1}};
+constexpr Comparator optimal3[] = {{0, 2}, {0, 1}, {1, 2}};
+constexpr Comparator optimal4[] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+constexpr Comparator optimal5[] = {{0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1}, {2, 4}, {1, 2}, {3, 4}, {2, 3}};
+constexpr Comparator optimal6[] = {{0, 5}, {1, 3}, {2, 4}, {1, 2}, {3, 4}, {0, 3},
+                                   {2, 5}, {0, 1}, {2, 3}, {4, 5}, {1, 2}, {3, 4}};
+constexpr Comparator optimal7[] = {{0, 6}, {2, 3}, {4, 5}, {0, 2}, {1, 4}, {3, 6}, {0, 1}, {2, 5},
+                                   {3, 4}, {1, 2}, {4, 6}, {2, 3}, {4, 5}, {1, 2}, {3, 4}, {5, 6}};
+constexpr Comparator optimal8[] = {{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6},
+                                   {3, 7}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5},
+                                   {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+
+template <std::size_t N>
+constexpr const Comparator* optimal() {
+    if constexpr (N == 2) return optimal2;
+    else if constexpr (N == 3) return optimal3;
+    else if constexpr (N == 4) return optimal4;
+    else if constexpr (N == 5) return optimal5;
+    else if constexpr (N == 6) return optimal6;
+    else if constexpr (N == 7) return optimal7;
+    else if constexpr (N == 8) return optimal8;
+    else return nullptr;
+}
+
+constexpr std::size_t optimalSizes[] = {0, 0, 1, 3, 5, 9, 12, 16, 19};
+
+// Batcher's merge exchange (Knuth, Algorithm 5.2.2M). Writes the
+// comparators to 'out' when given and returns how many there are.
+constexpr std::size_t mergeExchange(std::size_t n, Comparator* out) {
+    std::size_t count = 0;
+    if (n < 2) return 0;
+
+    std::size_t t = 0;
+    while ((std::size_t(1) << t) < n) ++t;
+
+    for (std::size_t p = std::size_t(1) << (t - 1); p > 0; p /= 2) {
+        std::size_t q = std::size_t(1) << (t - 1);
+        std::size_t r = 0;
+        std::size_t d = p;
+
+        while (d > 0) {
+            for (std::size_t i = 0; i + d < n; ++i) {
+                if ((i & p) == r) {
+                    if (out) out[count] = Comparator{static_cast<int>(i), static_cast<int>(i + d)};
+                    ++count;
+                }
+            }
+            d = q - p;
+            q /= 2;
+            r = p;
+        }
+    }
+    return count;
+}
+
+} // namespace SortingNetworkTables
+
+template <std::size_t N, typename T>
+constexpr std::size_t SortingNetwork<N, T>::comparatorCount() {
+    if constexpr (N <= 8) {
+        return SortingNetworkTables::optimalSizes[N];
+    } else {
+        return SortingNetworkTables::mergeExchange(N, nullptr);
+    }
+}
+
+template <std::size_t N, typename T>
+constexpr auto SortingNetwork<N, T>::comparators() {
+    std::array<Comparator, comparatorCount()> result{};
+
+    if constexpr (N <= 8) {
+        const Comparator* table = SortingNetworkTables::optimal<N>();
+        for (std::size_t i = 0; i < comparatorCount(); ++i) {
+            result[i] = table[i];
+        }
+    } else {
+        SortingNetworkTables::mergeExchange(N, result.data());
+    }
+    return result;
+}
+
+// Branchless: min/max for floating point (minss/maxsd), one shared
+// comparison feeding two conditional moves for everything else
+template <std::size_t N, typename T>
+constexpr void SortingNetwork<N, T>::compareExchange(T& a, T& b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        T low = std::min(a, b);
+        T high = std::max(a, b);
+        a = low;
+        b = high;
+    } else {
+        bool swap = b < a;
+        T low = swap ? b : a;
+        T high = swap ? a : b;
+        a = low;
+        b = high;
+    }
+}
+
+// Fully unrolled: one compareExchange per comparator, indices are constants
+template <std::size_t N, typename T>
+template <std::size_t... I>
+constexpr void SortingNetwork<N, T>::apply(T* values, std::index_sequence<I...>) {
+    constexpr auto network = comparators();
+    (compareExchange(values[network[I].low], values[network[I].high]), ...);
+}
+
+template <std::size_t N, typename T>
+constexpr void SortingNetwork<N, T>::sort(T* values) {
+    if constexpr (comparatorCount() > 0) {
+        apply(values, std::make_index_sequence<comparatorCount()>{});
+    }
+}
+
+template <std::size_t N, typename T>
+constexpr void SortingNetwork<N, T>::sort(std::array<T, N>& values) {
+    sort(values.data());
+}
+
+template <std::size_t N, typename T>
+constexpr bool SortingNetwork<N, T>::sortsAllZeroOneInputs() {
+    for (unsigned long long mask = 0; mask < (1ULL << N); ++mask) {
+        std::array<int, N> bits{};
+        for (std::size_t i = 0; i < N; ++i) {
+            bits[i] = static_cast<int>((mask >> i) & 1ULL);
+        }
+
+        SortingNetwork<N, int>::sort(bits);
+
+        for (std::size_t i = 1; i < N; ++i) {
+            if (bits[i - 1] > bits[i]) return false;
+        }
+    }
+    return true;
+}
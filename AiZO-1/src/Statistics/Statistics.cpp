@@ -0,0 +1,39 @@
+#include "Statistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+SampleSummary Statistics::summarize(std::vector<double> samples) {
+    SampleSummary summary;
+    summary.count = static_cast<int>(samples.size());
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    summary.min = samples.front();
+    summary.max = samples.back();
+
+    size_t middle = samples.size() / 2;
+    summary.median = (samples.size() % 2 == 1) ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2.0;
+    summary.p95 = percentile(samples, 95.0);
+
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+    summary.mean = sum / samples.size();
+
+    if (samples.size() > 1) {
+        double squares = 0.0;
+        for (double sample : samples) squares += (sample - summary.mean) * (sample - summary.mean);
+        summary.stddev = std::sqrt(squares / (samples.size() - 1));
+    }
+    return summary;
+}
+
+double Statistics::percentile(const std::vector<double>& sorted, double percent) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted.size()));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
@@ -0,0 +1,25 @@
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <vector>
+
+// Order statistics and moments of a set of timing samples
+struct SampleSummary {
+    int count = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double stddev = 0.0;  // sample standard deviation (n - 1)
+};
+
+class Statistics {
+public:
+    static SampleSummary summarize(std::vector<double> samples);
+
+    // Nearest-rank percentile (0..100) of already sorted samples
+    static double percentile(const std::vector<double>& sorted, double percent);
+};
+
+#endif // STATISTICS_H
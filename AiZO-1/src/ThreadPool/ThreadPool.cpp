@@ -0,0 +1,130 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace {
+// Index of the worker running on this thread, -1 outside the pool
+thread_local int currentWorker = -1;
+thread_local const ThreadPool* currentPool = nullptr;
+}
+
+// Constructor: start the workers
+ThreadPool::ThreadPool(int threadCount)
+    : pending(0),
+      queued(0),
+      nextQueue(0),
+      stopping(false) {
+    int count = std::max(1, threadCount);
+
+    for (int i = 0; i < count; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (int i = 0; i < count; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+// Destructor: finish outstanding work, then join the workers
+ThreadPool::~ThreadPool() {
+    waitIdle();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    int index;
+    if (currentPool == this && currentWorker >= 0) {
+        index = currentWorker;
+    } else {
+        index = static_cast<int>(nextQueue++ % queues.size());
+    }
+
+    pending++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // Taking the state lock orders this with a worker about to sleep
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queued++;
+    }
+    workAvailable.notify_one();
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pending.load() == 0; });
+}
+
+int ThreadPool::getThreadCount() const {
+    return static_cast<int>(workers.size());
+}
+
+int ThreadPool::hardwareThreads() {
+    unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : static_cast<int>(count);
+}
+
+// Take the newest task from our own deque
+bool ThreadPool::popLocal(int index, std::function<void()>& task) {
+    std::lock_guard<std::mutex> lock(queues[index]->mutex);
+    if (queues[index]->tasks.empty()) {
+        return false;
+    }
+    task = std::move(queues[index]->tasks.back());
+    queues[index]->tasks.pop_back();
+    queued--;
+    return true;
+}
+
+// Take the oldest task from another worker's deque
+bool ThreadPool::steal(int thief, std::function<void()>& task) {
+    int count = static_cast<int>(queues.size());
+
+    for (int offset = 1; offset < count; ++offset) {
+        WorkQueue& victim = *queues[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::finishTask() {
+    if (--pending == 0) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        allDone.notify_all();
+    }
+}
+
+void ThreadPool::workerLoop(int index) {
+    currentWorker = index;
+    currentPool = this;
+
+    while (true) {
+        std::function<void()> task;
+
+        if (popLocal(index, task) || steal(index, task)) {
+            task();
+            finishTask();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workAvailable.wait(lock, [this] { return stopping || queued.load() > 0; });
+        if (stopping && queued.load() == 0) {
+            return;
+        }
+    }
+}
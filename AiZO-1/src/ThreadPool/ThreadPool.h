@@ -0,0 +1,58 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool. Every worker owns a deque: it pushes and pops
+// its own tasks at the back (LIFO, cache friendly) and steals from the front
+// of other workers' deques (FIFO, biggest pieces first) when it runs dry.
+class ThreadPool {
+public:
+    explicit ThreadPool(int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task. From inside a worker it goes to that worker's deque.
+    void submit(std::function<void()> task);
+
+    // Block until every submitted task (including nested ones) finished
+    void waitIdle();
+
+    int getThreadCount() const;
+
+    // Number of hardware threads, at least 1
+    static int hardwareThreads();
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    std::atomic<long long> pending;   // Submitted but not yet finished
+    std::atomic<long long> queued;    // Sitting in some deque
+    std::atomic<unsigned> nextQueue;
+    bool stopping;
+
+    bool popLocal(int index, std::function<void()>& task);
+    bool steal(int thief, std::function<void()>& task);
+    void workerLoop(int index);
+    void finishTask();
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,110 @@
+#include "PhaseProfiler.h"
+
+#include <cstdio>
+#include <iomanip>
+
+PhaseProfiler::Scope::Scope(PhaseProfiler& profiler, Phase phase)
+    : profiler(&profiler), phase(phase), startTime(Timer::now()) {}
+
+PhaseProfiler::Scope::~Scope() {
+    stop();
+}
+
+void PhaseProfiler::Scope::stop() {
+    if (profiler != nullptr) {
+        profiler->add(phase, Timer::now() - startTime);
+        profiler = nullptr;
+    }
+}
+
+PhaseProfiler::PhaseProfiler() {
+    reset();
+}
+
+void PhaseProfiler::reset() {
+    for (int i = 0; i < phaseCount; ++i) {
+        totals[i] = 0;
+        counts[i] = 0;
+    }
+}
+
+PhaseProfiler::Scope PhaseProfiler::scope(Phase phase) {
+    return Scope(*this, phase);
+}
+
+void PhaseProfiler::add(Phase phase, long long ns) {
+    totals[static_cast<int>(phase)] += ns;
+    counts[static_cast<int>(phase)]++;
+}
+
+long long PhaseProfiler::getTotalNs(Phase phase) const {
+    return totals[static_cast<int>(phase)];
+}
+
+int PhaseProfiler::getCount(Phase phase) const {
+    return counts[static_cast<int>(phase)];
+}
+
+long long PhaseProfiler::getTotalNs() const {
+    long long total = 0;
+    for (int i = 0; i < phaseCount; ++i) {
+        total += totals[i];
+    }
+    return total;
+}
+
+void PhaseProfiler::print(std::ostream& out) const {
+    long long total = getTotalNs();
+
+    out << "Phase breakdown (" << Timer::clockName() << "):\n";
+    for (int i = 0; i < phaseCount; ++i) {
+        if (counts[i] == 0) continue;
+
+        double percent = total > 0 ? (100.0 * totals[i]) / total : 0.0;
+        out << "  " << std::left << std::setw(10) << phaseName(static_cast<Phase>(i)) << std::right
+            << std::fixed << std::setprecision(3) << std::setw(12) << totals[i] / 1e6 << " ms"
+            << std::setprecision(1) << std::setw(7) << percent << "%\n";
+    }
+    out << "  " << std::left << std::setw(10) << "total" << std::right << std::fixed << std::setprecision(3)
+        << std::setw(12) << total / 1e6 << " ms\n";
+    out.unsetf(std::ios::floatfield);
+    out << std::setprecision(6);
+}
+
+bool PhaseProfiler::appendCsv(const std::string& filename, const std::string& label) const {
+    FILE* file = fopen(filename.c_str(), "a");
+    if (file == nullptr) {
+        return false;
+    }
+
+    // An empty file is a new one and gets the header
+    fseek(file, 0, SEEK_END);
+    if (ftell(file) == 0) {
+        fprintf(file, "label;clock");
+        for (int i = 0; i < phaseCount; ++i) {
+            fprintf(file, ";%s_ns", phaseName(static_cast<Phase>(i)));
+        }
+        fprintf(file, ";total_ns\n");
+    }
+
+    fprintf(file, "%s;%s", label.c_str(), Timer::clockName());
+    for (int i = 0; i < phaseCount; ++i) {
+        fprintf(file, ";%lld", totals[i]);
+    }
+    fprintf(file, ";%lld\n", getTotalNs());
+
+    return fclose(file) == 0;
+}
+
+const char* PhaseProfiler::phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::Load: return "load";
+        case Phase::Generate: return "generate";
+        case Phase::CopyIn: return "copy_in";
+        case Phase::Sort: return "sort";
+        case Phase::CopyOut: return "copy_out";
+        case Phase::Verify: return "verify";
+        case Phase::Save: return "save";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "Timer.h"
+
+// The stages of one run, in the order they happen
+enum class Phase { Load, Generate, CopyIn, Sort, CopyOut, Verify, Save, Count };
+
+// Accumulates nanosecond totals per phase. Phases are timed with scope():
+//
+//     {
+//         auto timed = profiler.scope(Phase::Sort);
+//         sorter.sort(values);
+//     }
+class PhaseProfiler {
+public:
+    // Times one phase from construction until stop() or destruction
+    class Scope {
+    public:
+        Scope(PhaseProfiler& profiler, Phase phase);
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope();
+        void stop();
+
+    private:
+        PhaseProfiler* profiler;
+        Phase phase;
+        long long startTime;
+    };
+
+    PhaseProfiler();
+    void reset();
+
+    Scope scope(Phase phase);
+    void add(Phase phase, long long ns);
+
+    long long getTotalNs(Phase phase) const;
+    int getCount(Phase phase) const;
+    long long getTotalNs() const;  // all phases
+
+    // Human-readable breakdown of the phases that ran
+    void print(std::ostream& out) const;
+
+    // One ';'-separated row per run, header written when the file is new or empty.
+    // Columns: label;clock;<phase>_ns...;total_ns
+    bool appendCsv(const std::string& filename, const std::string& label) const;
+
+    static const char* phaseName(Phase phase);
+
+private:
+    static constexpr int phaseCount = static_cast<int>(Phase::Count);
+
+    long long totals[phaseCount];
+    int counts[phaseCount];
+};
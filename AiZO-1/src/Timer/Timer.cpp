@@ -1,33 +1,113 @@
 #include "Timer.h"
 #include <chrono>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define TIMER_HAS_TSC 1
+#endif
+
+namespace {
+
+bool tscEnabled = false;
+double nsPerTick = 0.0;
+unsigned long long tscBase = 0;
+
+long long steadyNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+#ifdef TIMER_HAS_TSC
+// Invariant TSC (CPUID 0x80000007, EDX bit 8) ticks at a constant rate across P/C-states
+bool hasInvariantTsc() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (edx & (1u << 8)) != 0;
+}
+
+// Measure the tick rate against steady_clock over ~20 ms
+void calibrateTsc() {
+    long long startNs = steadyNow();
+    unsigned long long startTicks = __rdtsc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    long long endNs = steadyNow();
+    unsigned long long endTicks = __rdtsc();
+
+    nsPerTick = static_cast<double>(endNs - startNs) / static_cast<double>(endTicks - startTicks);
+    tscBase = endTicks;
+}
+#endif
+
+}  // namespace
 
 Timer::Timer() {
     // Constructor: Initialize any necessary resources
-    startTime = std::chrono::high_resolution_clock::now();
+    startTime = now();
+    endTime = startTime;
 }
 
 void Timer::reset() {
     // Reset the timer by setting both time points to current time
-    startTime = std::chrono::high_resolution_clock::now();
+    startTime = now();
     endTime = startTime;
 }
 
 int Timer::start() {
     // Start the timer by capturing the current time
-    startTime = std::chrono::high_resolution_clock::now();
+    startTime = now();
     return 0;
 }
 
 int Timer::stop() {
     // Stop the timer by capturing the end time
-    endTime = std::chrono::high_resolution_clock::now();
+    endTime = now();
     return 0;
 }
 
 int Timer::result() {
     // Calculate and return elapsed time in milliseconds
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-        endTime - startTime
-    );
-    return static_cast<int>(duration.count());
-}
\ No newline at end of file
+    return static_cast<int>(resultNs() / 1000000);
+}
+
+long long Timer::resultNs() {
+    return endTime - startTime;
+}
+
+double Timer::resultMs() {
+    return static_cast<double>(resultNs()) / 1e6;
+}
+
+long long Timer::now() {
+#ifdef TIMER_HAS_TSC
+    if (tscEnabled) {
+        return static_cast<long long>(static_cast<double>(__rdtsc() - tscBase) * nsPerTick);
+    }
+#endif
+    return steadyNow();
+}
+
+bool Timer::useTsc(bool enable) {
+    if (!enable) {
+        tscEnabled = false;
+        return true;
+    }
+#ifdef TIMER_HAS_TSC
+    if (hasInvariantTsc()) {
+        if (nsPerTick == 0.0) {
+            calibrateTsc();
+        }
+        tscEnabled = true;
+        return true;
+    }
+#endif
+    return false;
+}
+
+const char* Timer::clockName() {
+    return tscEnabled ? "tsc" : "steady_clock";
+}
@@ -8,10 +8,20 @@ public:
     void reset();
     int start();
     int stop();
-    int result();
+    int result();             // whole milliseconds
+    long long resultNs();     // nanoseconds
+    double resultMs();        // milliseconds with sub-millisecond precision
+
+    // Current time in nanoseconds on the active clock (steady_clock or TSC)
+    static long long now();
+
+    // Switch every Timer to the calibrated time-stamp counter. Returns false
+    // (and keeps steady_clock) when the CPU has no invariant TSC.
+    static bool useTsc(bool enable);
+    static const char* clockName();
 
 private:
     // Everything else you need, both fields and methods.
-    std::chrono::high_resolution_clock::time_point startTime;
-    std::chrono::high_resolution_clock::time_point endTime;
-};
\ No newline at end of file
+    long long startTime;
+    long long endTime;
+};
@@ -3,7 +3,13 @@
 
 #include <string>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "../RandomGenerator/RandomGenerator.h"
+#include "../RandomGenerator/ZipfSampler.h"
+#include "../DataFile/BinaryFormat.h"
+#include "../DataFile/TextParser.h"
+#include "../DataFile/TextWriter.h"
 
 // Vector class template declaration
 template <typename T>
@@ -13,14 +19,28 @@ private:
     int capacity;
     int size;
 
-    void resize(int newCapacity);
+    // Trivially copyable types live in malloc'd memory and grow with realloc
+    static constexpr bool triviallyCopyable = std::is_trivially_copyable<T>::value;
+
+    static T* allocate(int count);
+    static void deallocate(T* pointer);
+    void reallocate(int newCapacity);
+    void destroyElements();
+    void generateSortedPortion(int start, int end);
+    void generateRandomPortion(int size, int start, int threads);
+
+    // Key in [0, keyCount) as a T, order preserved: the key itself for
+    // numbers, spread evenly over 'a'..'z' for char
+    static T fromKey(long long key, long long keyCount);
 
 public:
     // Constructor and destructor
     Vector();
     explicit Vector(int initialCapacity);
     Vector(const Vector<T>& other);
+    Vector(Vector<T>&& other) noexcept;
     Vector<T>& operator=(const Vector<T>& other);
+    Vector<T>& operator=(Vector<T>&& other) noexcept;
     ~Vector();
 
     // Element access
@@ -33,20 +53,51 @@ public:
     int getCapacity() const;
     void reserve(int newCapacity);
 
+    // Raw storage access
+    T* getData();
+    const T* getData() const;
+
     // Modifiers needed for sorting algorithms
     void clear();
     void pushBack(const T& value);
+    void pushBack(T&& value);
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
 
-    // File operations - kept for data loading
-    int loadFromFile(const std::string &filename);
+    // Grow or shrink to newSize without initializing new slots;
+    // only for trivially copyable T, callers must fill them
+    void resizeUninitialized(int newSize);
+
+    // File operations - kept for data loading; text is parsed on 'threads'
+    // threads (0 = all hardware threads, see DataFile/TextParser.h)
+    int loadFromFile(const std::string &filename, int threads = 0);
+    // Binary datasets (see DataFile/BinaryFormat.h): memory-mapped, copied in once
+    int loadFromBinaryFile(const std::string& filename);
     
-    // Generation methods - useful for testing sort algorithms
-    void generateRandom(int size);
+    // Generation methods - useful for testing sort algorithms. Random values
+    // come from the next dataset stream of RandomGenerator's seed and are
+    // drawn on 'threads' threads (0 = all hardware threads); the result does
+    // not depend on the thread count.
+    void generateRandom(int size, int threads = 0);
     void generateAscending(int size);
     void generateDescending(int size);
+    void generateSorted33(int size, int threads = 0);
+    void generateSorted66(int size, int threads = 0);
+
+    // Skewed and structured inputs, written straight into the storage
+    void generateZipf(int size, double exponent = 1.0, int threads = 0);  // key k-1 with P ~ 1/k^exponent, k in 1..size
+    void generateFewUnique(int size, int distinct = 16, int threads = 0);  // 'distinct' values, uniformly mixed
+    void generateOrganPipe(int size);                                      // ascending to the middle, then descending
+    void generateSawtooth(int size, int teeth = 8);                        // 'teeth' ascending runs
+    void generateSortedSwaps(int size, int swaps = 16);                    // ascending with 'swaps' random pairs exchanged
+    void generateNoisy(int size, int distance = 16, int threads = 0);     // key i moved by up to +-distance
 
     // Utility
     void print() const;
+    void saveToFile(const std::string& filename, int threads = 0) const;
+    int saveToBinaryFile(const std::string& filename) const;
+    int checkSorted() const;
+    int sortedPrefix() const;  // like checkSorted(), without printing
 };
 
 #include "Vector.tpp"
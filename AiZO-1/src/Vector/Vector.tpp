@@ -1,7 +1,13 @@
 #include <iostream>
+#include <cstdio>
 #include <fstream>
 #include <type_traits>
 #include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
 
 // Default constructor
 template <typename T>
@@ -10,50 +16,72 @@ Vector<T>::Vector()
       capacity(0), 
       size(0) {}
 
-// Constructor with initial capacity
+// Constructor with initial capacity - storage is left uninitialized
 template <typename T>
 Vector<T>::Vector(int initialCapacity) 
-    : capacity(initialCapacity), 
+    : data(nullptr),
+      capacity(0), 
       size(0) {
     if (initialCapacity > 0) {
-        data = new T[initialCapacity];
-    } else {
-        data = nullptr;
+        data = allocate(initialCapacity);
+        capacity = initialCapacity;
     }
 }
 
 // Copy constructor
 template <typename T>
 Vector<T>::Vector(const Vector<T>& other)
-    : capacity(other.capacity),
-      size(other.size) {
-    if (capacity > 0) {
-        data = new T[capacity];
-        for (int i = 0; i < size; ++i) {
-            data[i] = other.data[i];
+    : data(nullptr),
+      capacity(0),
+      size(0) {
+    if (other.size > 0) {
+        data = allocate(other.size);
+        capacity = other.size;
+
+        if constexpr (triviallyCopyable) {
+            std::memcpy(data, other.data, sizeof(T) * other.size);
+        } else {
+            std::uninitialized_copy(other.data, other.data + other.size, data);
         }
-    } else {
-        data = nullptr;
+        size = other.size;
     }
 }
 
+// Move constructor - steals the buffer
+template <typename T>
+Vector<T>::Vector(Vector<T>&& other) noexcept
+    : data(other.data),
+      capacity(other.capacity),
+      size(other.size) {
+    other.data = nullptr;
+    other.capacity = 0;
+    other.size = 0;
+}
+
 // Copy assignment operator
 template <typename T>
 Vector<T>& Vector<T>::operator=(const Vector<T>& other) {
     if (this != &other) { // Self-assignment check
-        delete[] data;
-        
+        Vector<T> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// Move assignment operator
+template <typename T>
+Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept {
+    if (this != &other) {
+        destroyElements();
+        deallocate(data);
+
+        data = other.data;
         capacity = other.capacity;
         size = other.size;
-        
-        if (capacity > 0) {
-            data = new T[capacity];
-            for (int i = 0; i < size; ++i) {
-                data[i] = other.data[i];
-            }
-        } else {
-            data = nullptr;
-        }
+
+        other.data = nullptr;
+        other.capacity = 0;
+        other.size = 0;
     }
     return *this;
 }
@@ -61,25 +89,66 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& other) {
 // Destructor
 template <typename T>
 Vector<T>::~Vector() {
-    delete[] data;
+    destroyElements();
+    deallocate(data);
+}
+
+// Get raw, uninitialized storage for 'count' elements
+template <typename T>
+T* Vector<T>::allocate(int count) {
+    if (count <= 0) {
+        return nullptr;
+    }
+
+    std::size_t bytes = sizeof(T) * static_cast<std::size_t>(count);
+    void* memory = triviallyCopyable ? std::malloc(bytes) : ::operator new(bytes);
+
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T*>(memory);
+}
+
+// Release storage obtained from allocate()
+template <typename T>
+void Vector<T>::deallocate(T* pointer) {
+    if constexpr (triviallyCopyable) {
+        std::free(pointer);
+    } else {
+        ::operator delete(pointer);
+    }
+}
+
+// Run destructors of all live elements (no-op for trivial types)
+template <typename T>
+void Vector<T>::destroyElements() {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (int i = 0; i < size; ++i) {
+            data[i].~T();
+        }
+    }
 }
 
-// Helper method to resize array
+// Helper method to move the elements into a buffer of newCapacity
 template <typename T>
-void Vector<T>::resize(int newCapacity) {
-    T* newData = new T[newCapacity];
-    
-    // Copy existing elements
-    int elementsToCopy = std::min(size, newCapacity);
-    for (int i = 0; i < elementsToCopy; ++i) {
-        newData[i] = data[i];
+void Vector<T>::reallocate(int newCapacity) {
+    if constexpr (triviallyCopyable) {
+        // realloc can often grow in place and never default-constructs
+        void* memory = std::realloc(data, sizeof(T) * static_cast<std::size_t>(newCapacity));
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        data = static_cast<T*>(memory);
+    } else {
+        T* newData = allocate(newCapacity);
+        for (int i = 0; i < size; ++i) {
+            new (newData + i) T(std::move_if_noexcept(data[i]));
+            data[i].~T();
+        }
+        deallocate(data);
+        data = newData;
     }
-    
-    // Delete old array and update state
-    delete[] data;
-    data = newData;
     capacity = newCapacity;
-    size = elementsToCopy;
 }
 
 // Element access without bounds checking - essential for sorting algorithms
@@ -116,119 +185,104 @@ int Vector<T>::getCapacity() const {
 template <typename T>
 void Vector<T>::reserve(int newCapacity) {
     if (newCapacity > capacity) {
-        T* newData = new T[newCapacity];
-        
-        // Copy existing elements
-        for (int i = 0; i < size; ++i) {
-            newData[i] = data[i];
-        }
-        
-        // Delete old array and update state
-        delete[] data;
-        data = newData;
-        capacity = newCapacity;
+        reallocate(newCapacity);
     }
 }
 
+// Raw pointer to the first element
+template <typename T>
+T* Vector<T>::getData() {
+    return data;
+}
+
+template <typename T>
+const T* Vector<T>::getData() const {
+    return data;
+}
+
 // Clear vector
 template <typename T>
 void Vector<T>::clear() {
+    destroyElements();
     size = 0;
 }
 
 // Add element to end - used by all sorting algorithms to build the vector
 template <typename T>
 void Vector<T>::pushBack(const T& value) {
-    // If we need more space
+    emplaceBack(value);
+}
+
+template <typename T>
+void Vector<T>::pushBack(T&& value) {
+    emplaceBack(std::move(value));
+}
+
+// Construct an element in place at the end
+template <typename T>
+template <typename... Args>
+T& Vector<T>::emplaceBack(Args&&... args) {
+    // If we need more space. The arguments may refer to our own elements,
+    // so build the new value before the old buffer goes away.
     if (size >= capacity) {
+        T value(std::forward<Args>(args)...);
         reserve(capacity == 0 ? 1 : capacity * 2);
+        T* slot = new (data + size) T(std::move(value));
+        size++;
+        return *slot;
     }
-    
-    data[size++] = value;
+
+    T* slot = new (data + size) T(std::forward<Args>(args)...);
+    size++;
+    return *slot;
+}
+
+// Change the size without touching the contents of new slots
+template <typename T>
+void Vector<T>::resizeUninitialized(int newSize) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "resizeUninitialized requires a trivially copyable type");
+    reserve(newSize);
+    size = newSize;
 }
 
-// Load vector data from file
+// Load vector data from file: count the values in parallel, then parse
+// them straight into our storage
 template <typename T>
-int Vector<T>::loadFromFile(const std::string &filename) {
+int Vector<T>::loadFromFile(const std::string &filename, int threads) {
     clear();
 
-    FILE *file = fopen(filename.c_str(), "r");
-    if (file == nullptr) {
-        std::cout << "File can not be read." << std::endl;
+    TextParser<T> parser(threads);
+    if (parser.open(filename) != 0) {
         return -1;
     }
-
-    int N;
-    fscanf(file, "%d", &N);
-    
-    // Reserve enough space
-    reserve(N);
-
-    // Handle different types for file reading
-    if (std::is_same<T, int>::value) {
-        for (int i = 0; i < N; i++) {
-            int value;
-            fscanf(file, "%d", &value);
-            pushBack(static_cast<T>(value));
-        }
-    } 
-    else if (std::is_same<T, float>::value) {
-        for (int i = 0; i < N; i++) {
-            float value;
-            fscanf(file, "%f", &value);
-            pushBack(static_cast<T>(value));
-        }
-    }
-    else if (std::is_same<T, double>::value) {
-        for (int i = 0; i < N; i++) {
-            double value;
-            fscanf(file, "%lf", &value);
-            pushBack(static_cast<T>(value));
-        }
-    }
-    else if (std::is_same<T, char>::value) {
-        for (int i = 0; i < N; i++) {
-            char value;
-            fscanf(file, " %c", &value);  // Space before %c consumes whitespace
-            pushBack(static_cast<T>(value));
-        }
-    }
-    else {
-        std::cout << "Unsupported type for file loading" << std::endl;
-        fclose(file);
+    if (parser.getCount() > static_cast<long long>(INT_MAX)) {
+        std::cerr << "File has too many elements for Vector: " << parser.getCount() << "\n";
         return -1;
     }
 
-    fclose(file);
+    resizeUninitialized(static_cast<int>(parser.getCount()));
+    if (parser.parseInto(data) != 0) {
+        clear();
+        return -1;
+    }
     return 0;
 }
 
 // Generate vector with random values
 template <typename T>
-void Vector<T>::generateRandom(int newSize) {
+void Vector<T>::generateRandom(int newSize, int threads) {
     clear();
-    reserve(newSize);
-    
-    RandomGenerator rng;
-    
-    for (int i = 0; i < newSize; ++i) {
-        // Generate appropriate random value based on type T
-        if (std::is_same<T, int>::value) {
-            pushBack(static_cast<T>(rng.getInt()));
-        }
-        else if (std::is_same<T, float>::value) {
-            pushBack(static_cast<T>(rng.getFloat()));
-        }
-        else if (std::is_same<T, double>::value) {
-            pushBack(static_cast<T>(rng.getFloat()));
-        }
-        else if (std::is_same<T, char>::value) {
-            pushBack(static_cast<T>(rng.getChar()));
-        }
-        else {
-            // Default case - just insert zeros if type not handled
-            pushBack(static_cast<T>(0));
-        }
+    resizeUninitialized(newSize);
+    RandomGenerator::forDataset().fill(data, newSize, threads);
+}
+
+template <typename T>
+T Vector<T>::fromKey(long long key, long long keyCount) {
+    if constexpr (std::is_same<T, char>::value) {
+        return static_cast<char>('a' + (keyCount > 1 ? key * 26 / keyCount : 0));
+    } else {
+        return static_cast<T>(key);
     }
 }
 
@@ -236,25 +290,10 @@ void Vector<T>::generateRandom(int newSize) {
 template <typename T>
 void Vector<T>::generateAscending(int newSize) {
     clear();
-    reserve(newSize);
-    
-    // For numeric types
-    if (std::is_arithmetic<T>::value) {
-        for (int i = 0; i < newSize; i++) {
-            pushBack(static_cast<T>(i));
-        }
-    }
-    // For char type
-    else if (std::is_same<T, char>::value) {
-        char startChar = 'a';
-        for (int i = 0; i < newSize; i++) {
-            pushBack(static_cast<T>(startChar + i));
-        }
-    }
-    else {
-        for (int i = 0; i < newSize; i++) {
-            pushBack(static_cast<T>(i));
-        }
+    resizeUninitialized(newSize);
+
+    for (int i = 0; i < newSize; i++) {
+        data[i] = fromKey(i, newSize);
     }
 }
 
@@ -262,25 +301,10 @@ void Vector<T>::generateAscending(int newSize) {
 template <typename T>
 void Vector<T>::generateDescending(int newSize) {
     clear();
-    reserve(newSize);
-    
-    // For numeric types
-    if (std::is_arithmetic<T>::value) {
-        for (int i = newSize - 1; i >= 0; i--) {
-            pushBack(static_cast<T>(i));
-        }
-    }
-    // For char type
-    else if (std::is_same<T, char>::value) {
-        char startChar = 'a' + newSize - 1;
-        for (int i = 0; i < newSize; i++) {
-            pushBack(static_cast<T>(startChar - i));
-        }
-    }
-    else {
-        for (int i = newSize - 1; i >= 0; i--) {
-            pushBack(static_cast<T>(i));
-        }
+    resizeUninitialized(newSize);
+
+    for (int i = 0; i < newSize; i++) {
+        data[i] = fromKey(newSize - 1 - i, newSize);
     }
 }
 
@@ -291,4 +315,232 @@ void Vector<T>::print() const {
         std::cout << data[i] << " ";
     }
     std::cout << std::endl;
-}
\ No newline at end of file
+}
+
+template <typename T>
+void Vector<T>::generateSortedPortion(int start, int end) {
+    for (int i = start; i < end; i++) {
+        pushBack(fromKey(i, end));
+    }
+}
+
+// Helper function to generate the random portion of the vector
+template <typename T>
+void Vector<T>::generateRandomPortion(int newSize, int start, int threads) {
+    resizeUninitialized(newSize);
+    RandomGenerator::forDataset().fill(data + start, newSize - start, threads);
+}
+
+// Generate the first 33% of the vector in sorted order, the rest in random order
+template <typename T>
+void Vector<T>::generateSorted33(int newSize, int threads) {
+    clear();
+    reserve(newSize);
+
+    int firstPartSize = static_cast<int>(newSize * 0.33);
+    generateSortedPortion(0, firstPartSize);
+    generateRandomPortion(newSize, firstPartSize, threads);
+}
+
+// Generate the first 66% of the vector in sorted order, the rest in random order
+template <typename T>
+void Vector<T>::generateSorted66(int newSize, int threads) {
+    clear();
+    reserve(newSize);
+
+    int firstPartSize = static_cast<int>(newSize * 0.66);
+    generateSortedPortion(0, firstPartSize);
+    generateRandomPortion(newSize, firstPartSize, threads);
+}
+
+// Zipfian keys: a few small keys dominate, the tail is long
+template <typename T>
+void Vector<T>::generateZipf(int newSize, double exponent, int threads) {
+    clear();
+    resizeUninitialized(newSize);
+
+    ZipfSampler sampler(newSize, exponent);
+    T* out = data;
+    RandomGenerator::forDataset().forEachBlock(newSize, threads,
+        [out, &sampler, newSize](RandomGenerator& rng, long long begin, long long end) {
+            for (long long i = begin; i < end; ++i) {
+                out[i] = fromKey(sampler.sample(rng) - 1, newSize);
+            }
+        });
+}
+
+// Only 'distinct' different values, spread over the key range
+template <typename T>
+void Vector<T>::generateFewUnique(int newSize, int distinct, int threads) {
+    clear();
+    resizeUninitialized(newSize);
+
+    T* out = data;
+    RandomGenerator::forDataset().forEachBlock(newSize, threads,
+        [out, distinct, newSize](RandomGenerator& rng, long long begin, long long end) {
+            for (long long i = begin; i < end; ++i) {
+                long long key = static_cast<long long>(rng.getBelow(distinct)) * newSize / distinct;
+                out[i] = fromKey(key, newSize);
+            }
+        });
+}
+
+// 0 1 2 ... middle ... 2 1 0
+template <typename T>
+void Vector<T>::generateOrganPipe(int newSize) {
+    clear();
+    resizeUninitialized(newSize);
+
+    int keyCount = (newSize + 1) / 2;
+    for (int i = 0; i < newSize; i++) {
+        data[i] = fromKey(std::min(i, newSize - 1 - i), keyCount);
+    }
+}
+
+// 'teeth' ascending runs of equal length, each restarting at the lowest key
+template <typename T>
+void Vector<T>::generateSawtooth(int newSize, int teeth) {
+    clear();
+    resizeUninitialized(newSize);
+
+    int length = (newSize + teeth - 1) / teeth;
+    for (int i = 0; i < newSize; i++) {
+        data[i] = fromKey(i % length, length);
+    }
+}
+
+// Sorted, then 'swaps' random pairs exchanged
+template <typename T>
+void Vector<T>::generateSortedSwaps(int newSize, int swaps) {
+    generateAscending(newSize);
+    if (newSize < 2) {
+        return;
+    }
+
+    RandomGenerator rng = RandomGenerator::forDataset();
+    for (int s = 0; s < swaps; s++) {
+        // Draw in a fixed order so a seed always yields the same dataset
+        int first = static_cast<int>(rng.getBelow(newSize));
+        int second = static_cast<int>(rng.getBelow(newSize));
+        std::swap(data[first], data[second]);
+    }
+}
+
+// Nearly sorted: key i plus uniform noise in [-distance, distance]
+template <typename T>
+void Vector<T>::generateNoisy(int newSize, int distance, int threads) {
+    clear();
+    resizeUninitialized(newSize);
+
+    T* out = data;
+    RandomGenerator::forDataset().forEachBlock(newSize, threads,
+        [out, distance, newSize](RandomGenerator& rng, long long begin, long long end) {
+            for (long long i = begin; i < end; ++i) {
+                long long key = i + static_cast<long long>(rng.getBelow(2 * distance + 1)) - distance;
+                key = key < 0 ? 0 : (key >= newSize ? newSize - 1 : key);
+                out[i] = fromKey(key, newSize);
+            }
+        });
+}
+
+// Load a binary dataset: map the file and copy the payload in one go
+template <typename T>
+int Vector<T>::loadFromBinaryFile(const std::string& filename) {
+    static_assert(BinaryFormat::typeTag<T>() != 0, "Binary files hold int, float, double or char");
+    clear();
+
+    MappedFile file;
+    if (file.open(filename) != 0) {
+        return -1;
+    }
+    if (file.getSize() < sizeof(BinaryHeader)) {
+        std::cerr << "Binary file is too short for its header.\n";
+        return -1;
+    }
+
+    BinaryHeader header;
+    std::memcpy(&header, file.getData(), sizeof(header));
+
+    uint64_t count = 0;
+    if (BinaryFormat::validate(header, BinaryFormat::typeTag<T>(), sizeof(T), file.getSize(), count) != 0) {
+        return -1;
+    }
+    if (count > static_cast<uint64_t>(INT_MAX)) {
+        std::cerr << "Binary file has too many elements for Vector: " << count << "\n";
+        return -1;
+    }
+
+    resizeUninitialized(static_cast<int>(count));
+    if (count > 0) {
+        std::memcpy(data, file.getData() + sizeof(header), count * sizeof(T));
+    }
+    if ((header.littleEndian != 0) != BinaryFormat::hostIsLittleEndian()) {
+        BinaryFormat::swapBytes(data, sizeof(T), count);
+    }
+    return 0;
+}
+
+// Save vector data to a file (same layout as List<T>::saveToFile); values
+// are formatted on 'threads' threads (0 = all, see DataFile/TextWriter.h)
+template <typename T>
+void Vector<T>::saveToFile(const std::string& filename, int threads) const {
+    TextWriter<T> writer(threads);
+    if (writer.open(filename) != 0) {
+        return;
+    }
+
+    writer.writeHeader(size);
+    writer.writeAll(data, size);
+    writer.close();
+}
+
+// Header plus the raw element array in host byte order
+template <typename T>
+int Vector<T>::saveToBinaryFile(const std::string& filename) const {
+    static_assert(BinaryFormat::typeTag<T>() != 0, "Binary files hold int, float, double or char");
+
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "Could not open file for writing: " << filename << std::endl;
+        return -1;
+    }
+
+    BinaryHeader header = BinaryFormat::makeHeader(BinaryFormat::typeTag<T>(), sizeof(T), static_cast<uint64_t>(size));
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(data, sizeof(T), size, file) == static_cast<size_t>(size);
+
+    if (fclose(file) != 0 || !written) {
+        std::cerr << "Error writing binary file: " << filename << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+// Length of the leading run that is in non-decreasing order
+template <typename T>
+int Vector<T>::sortedPrefix() const {
+    if (size == 0) {
+        return 0;
+    }
+
+    int correctCount = 1;
+    while (correctCount < size && data[correctCount - 1] <= data[correctCount]) {
+        correctCount++;
+    }
+    return correctCount;
+}
+
+// Percentage of the leading run that is in non-decreasing order
+template <typename T>
+int Vector<T>::checkSorted() const {
+    if (size <= 1) {
+        std::cout << "Vector is empty or contains a single element.\n";
+        return 100;  // 100% sorted if 0 or 1 element
+    }
+
+    int correctCount = sortedPrefix();
+    int percent = static_cast<int>((100.0 * correctCount) / size);
+    std::cout << correctCount << " out of " << size << " elements sorted correctly (" 
+              << percent << "%).\n";
+    return percent;
+}
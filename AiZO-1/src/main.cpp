@@ -1,15 +1,55 @@
 #include <iostream>
+#include <algorithm>
 #include <fstream>
 #include <string>
 #include <cctype> // for std::tolower
-#include "./List/List.h"
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <vector>
+#include "./Vector/Vector.h"
 #include "./Timer/Timer.h"
+#include "./Timer/PhaseProfiler.h"
+#include "./Statistics/Statistics.h"
+#include "./PerfCounters/PerfCounters.h"
+#include "./ThreadPool/ThreadPool.h"
 
 #include "./SortingAlgorithms/QuickSort/QuickSort.h"
 #include "./SortingAlgorithms/QuickSortDrunk/QuickSortDrunk.h"
 #include "./SortingAlgorithms/InsertionSort/InsertionSort.h"
 #include "./SortingAlgorithms/ShellSort/ShellSort.h"
 #include "./SortingAlgorithms/HeapSort/HeapSort.h"
+#include "./SortingAlgorithms/IntroSort/IntroSort.h"
+#include "./SortingAlgorithms/RadixSort/RadixSort.h"
+#include "./SortingAlgorithms/CountingSort/CountingSort.h"
+#include "./SortingAlgorithms/ExternalSort/ExternalSort.h"
+#include "./SortingAlgorithms/KWayMerge/KWayMerge.h"
+
+// Optional flags accepted after the positional arguments
+struct RunOptions {
+    int threads = 0;  // 0 = sequential path, N = work-stealing pool of N workers
+    char pivot = 0;   // 0 = the algorithm's default pivot strategy
+    bool kernels = false;  // finish small ranges with sorting-network kernels
+    long long memoryLimit = 0;  // --external run size in bytes, 0 = ExternalSort default
+    std::string tempDirectory;  // --external spill directory, empty = $TMPDIR or /tmp
+    long long bufferSize = 0;   // --merge per-file buffer in bytes, 0 = KWayMerge default
+    bool binaryOutput = false;  // write the sorted data in the binary format
+    bool tsc = false;           // time with the calibrated TSC instead of steady_clock
+    std::string profileFile;    // append each run's phase breakdown to this CSV
+    bool perf = false;          // read hardware counters around each sort
+    bool stats = false;         // count comparisons, swaps, ... in an extra untimed sort
+    bool noPrefetch = false;    // heap variants: skip the grandchild prefetch
+
+    // --bench grid: comma-separated lists, empty = the sort_tester.sh defaults
+    std::string algorithms;
+    std::string types;
+    std::string sizes;
+    std::string orders;
+    int iterations = 100;
+    int trials = 1000;  // --montecarlo seeded sorts per drunk level
+    int warmup = 3;
+    std::string resultsDir = "results";
+};
 
 std::string toLower(const std::string& str) {
     std::string result;
@@ -18,106 +58,946 @@ std::string toLower(const std::string& str) {
     return result;
 }
 
+bool isOption(const char* arg) {
+    return arg[0] == '-' && arg[1] == '-';
+}
+
+// Parse trailing "--name value" flags starting at argv[first]
+bool parseOptions(int argc, char* argv[], int first, RunOptions& options) {
+    for (int i = first; i < argc; ++i) {
+        std::string name = toLower(argv[i]);
+
+        if (name == "--threads" && i + 1 < argc) {
+            try {
+                options.threads = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid thread count: " << argv[i] << "\n";
+                return false;
+            }
+            if (options.threads < 1) {
+                std::cerr << "Thread count must be at least 1.\n";
+                return false;
+            }
+        } else if (name == "--memory" && i + 1 < argc) {
+            long long megabytes = 0;
+            try {
+                megabytes = std::stoll(argv[++i]);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid memory limit: " << argv[i] << "\n";
+                return false;
+            }
+            if (megabytes < 1) {
+                std::cerr << "Memory limit must be at least 1 MiB.\n";
+                return false;
+            }
+            options.memoryLimit = megabytes << 20;
+        } else if (name == "--buffer" && i + 1 < argc) {
+            long long kilobytes = 0;
+            try {
+                kilobytes = std::stoll(argv[++i]);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid buffer size: " << argv[i] << "\n";
+                return false;
+            }
+            if (kilobytes < 4) {
+                std::cerr << "Buffer size must be at least 4 KiB.\n";
+                return false;
+            }
+            options.bufferSize = kilobytes << 10;
+        } else if (name == "--tmp-dir" && i + 1 < argc) {
+            options.tempDirectory = argv[++i];
+        } else if ((name == "--algorithms" || name == "--types" || name == "--sizes" || name == "--orders") &&
+                   i + 1 < argc) {
+            std::string list = toLower(argv[++i]);
+            if (name == "--algorithms") options.algorithms = list;
+            else if (name == "--types") options.types = list;
+            else if (name == "--sizes") options.sizes = list;
+            else options.orders = list;
+        } else if ((name == "--iterations" || name == "--warmup") && i + 1 < argc) {
+            int count = -1;
+            try {
+                count = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+            }
+            if (count < (name == "--iterations" ? 1 : 0)) {
+                std::cerr << "Invalid " << name.substr(2) << " count: " << argv[i] << "\n";
+                return false;
+            }
+            (name == "--iterations" ? options.iterations : options.warmup) = count;
+        } else if (name == "--trials" && i + 1 < argc) {
+            int count = -1;
+            try {
+                count = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+            }
+            if (count < 1) {
+                std::cerr << "Invalid trials count: " << argv[i] << "\n";
+                return false;
+            }
+            options.trials = count;
+        } else if (name == "--results" && i + 1 < argc) {
+            options.resultsDir = argv[++i];
+        } else if (name == "--stats") {
+            options.stats = true;
+        } else if (name == "--no-prefetch") {
+            options.noPrefetch = true;
+        } else if (name == "--perf") {
+            options.perf = true;
+        } else if (name == "--seed" && i + 1 < argc) {
+            try {
+                size_t parsed = 0;
+                unsigned long long seed = std::stoull(argv[++i], &parsed);
+                if (parsed != std::string(argv[i]).size()) throw std::invalid_argument("seed");
+                RandomGenerator::setSeed(seed);
+            } catch (const std::exception&) {
+                std::cerr << "Invalid seed: " << argv[i] << "\n";
+                return false;
+            }
+        } else if (name == "--tsc") {
+            options.tsc = true;
+        } else if (name == "--profile" && i + 1 < argc) {
+            options.profileFile = argv[++i];
+        } else if (name == "--binary") {
+            options.binaryOutput = true;
+        } else if (name == "--kernels") {
+            options.kernels = true;
+        } else if (name == "--pivot" && i + 1 < argc) {
+            std::string pivot = toLower(argv[++i]);
+            if (pivot.size() != 1 || !PivotSelector<int>::isValid(pivot[0])) {
+                std::cerr << "Invalid pivot strategy: " << argv[i] << ". Use l, m, r, x, 3 or n.\n";
+                return false;
+            }
+            options.pivot = pivot[0];
+        } else {
+            std::cerr << "Unknown or incomplete option: " << argv[i] << "\n";
+            return false;
+        }
+    }
+
+    if (options.tsc && !Timer::useTsc(true)) {
+        std::cerr << "No invariant TSC on this CPU, timing with steady_clock.\n";
+    }
+    return true;
+}
+
+// insertion, insertion-sentinel, insertion-binary
+bool parseInsertionVariant(const std::string& algorithm, InsertionVariant& variant) {
+    if (algorithm == "insertion") variant = InsertionVariant::Linear;
+    else if (algorithm == "insertion-sentinel") variant = InsertionVariant::Sentinel;
+    else if (algorithm == "insertion-binary") variant = InsertionVariant::Binary;
+    else return false;
+    return true;
+}
+
+// heap, heap-iter, heap-bottomup, heap-4ary, heap-8ary
+bool parseHeapVariant(const std::string& algorithm, HeapVariant& variant) {
+    if (algorithm == "heap") variant = HeapVariant::Classic;
+    else if (algorithm == "heap-iter") variant = HeapVariant::Iterative;
+    else if (algorithm == "heap-bottomup") variant = HeapVariant::BottomUp;
+    else if (algorithm == "heap-4ary") variant = HeapVariant::FourAry;
+    else if (algorithm == "heap-8ary") variant = HeapVariant::EightAry;
+    else return false;
+    return true;
+}
+
+// shell (the fastest sequence for T), shell-papernov, shell-tokuda, shell-ciura,
+// shell-sedgewick, shell-pratt
 template<typename T>
-void sortAndSave(List<T>& list, const std::string& algorithm, const std::string& outputFile) {
-    Timer timer;
-    timer.start();
+bool parseShellGaps(const std::string& algorithm, int& gaps) {
+    if (algorithm == "shell") {
+        gaps = ShellSort<T>::fastestGaps;
+        return true;
+    }
+    for (int sequence = GapSequences::PapernovStasevich; GapSequences::isValid(sequence); ++sequence) {
+        if (algorithm == std::string("shell-") + GapSequences::name(sequence)) {
+            gaps = sequence;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Run the named algorithm on values; false if the name is unknown or unusable for T.
+// With a Stats policy other than NoStats, the instrumented sorters copy their
+// counts to *stats.
+template<typename T, typename Stats = NoStats>
+bool sortWithAlgorithm(Vector<T>& values, const std::string& algorithm, const RunOptions& options,
+                       Stats* stats = nullptr) {
+    char pivot = options.pivot ? options.pivot : 'm';
 
     if (algorithm == "quick") {
-        QuickSort<T> sorter;
-        sorter.sort(list, 'm');
+        QuickSort<T, Stats> sorter;
+        sorter.setSmallSortKernels(options.kernels);
+        if constexpr (!Stats::enabled) {
+            if (options.threads > 0) {
+                sorter.sortParallel(values, pivot, options.threads);
+            } else {
+                sorter.sort(values, pivot);
+            }
+        } else {
+            sorter.sort(values, pivot);
+        }
+        if (stats) *stats = sorter.getStats();
+    } else if (algorithm == "quick-3way") {
+        QuickSort<T, Stats> sorter;
+        sorter.setSmallSortKernels(options.kernels);
+        sorter.sort3Way(values, pivot);
+        if (stats) *stats = sorter.getStats();
+    } else if (algorithm == "intro") {
+        IntroSort<T> sorter;
+        sorter.sort(values, options.pivot ? options.pivot : '3');
     } else if (algorithm.rfind("quick-drunk-", 0) == 0) {
         int drunk_level = std::stoi(algorithm.substr(12));
         if (drunk_level >= 1 && drunk_level <= 5) {
-            QuickSortDrunk<T> sorter(drunk_level);
-            sorter.sort(list, 'm');
+            QuickSortDrunk<T, Stats> sorter(drunk_level);
+            sorter.sort(values, pivot);
+            if (stats) *stats = sorter.getStats();
         } else {
             std::cerr << "Invalid drunk level for QuickSortDrunk. Use 1-5.\n";
-            return;
-        }
-    } else if (algorithm == "insertion") {
-        InsertionSort<T> sorter;
-        sorter.sort(list);
-    } else if (algorithm == "shell") {
-        ShellSort<T> sorter;
-        sorter.sort(list, 2);  // Replace 2 with a variable/constant if configurable
-    } else if (algorithm == "heap") {
-        HeapSort<T> sorter;
-        sorter.sort(list);
+            return false;
+        }
+    } else if (algorithm.rfind("insertion", 0) == 0) {
+        InsertionVariant variant;
+        if (!parseInsertionVariant(algorithm, variant)) {
+            std::cerr << "Invalid insertion variant. Use insertion, insertion-sentinel or insertion-binary.\n";
+            return false;
+        }
+        InsertionSort<T, Stats> sorter;
+        sorter.setVariant(variant);
+        sorter.sort(values);
+        if (stats) *stats = sorter.getStats();
+    } else if (algorithm.rfind("shell", 0) == 0) {
+        int gaps;
+        if (!parseShellGaps<T>(algorithm, gaps)) {
+            std::cerr << "Invalid shell gap sequence. Use shell, shell-papernov, shell-tokuda, shell-ciura, "
+                         "shell-sedgewick or shell-pratt.\n";
+            return false;
+        }
+        ShellSort<T, Stats> sorter;
+        sorter.setSmallSortKernels(options.kernels);
+        sorter.sort(values, gaps);
+        if (stats) *stats = sorter.getStats();
+    } else if (algorithm.rfind("heap", 0) == 0) {
+        HeapVariant variant;
+        if (!parseHeapVariant(algorithm, variant)) {
+            std::cerr << "Invalid heap variant. Use heap, heap-iter, heap-bottomup, heap-4ary or heap-8ary.\n";
+            return false;
+        }
+        HeapSort<T, Stats> sorter;
+        sorter.setVariant(variant);
+        sorter.setPrefetch(!options.noPrefetch);
+        sorter.sort(values);
+        if (stats) *stats = sorter.getStats();
+    } else if (algorithm == "radix") {
+        RadixSort<T> sorter;
+        sorter.sort(values);
+    } else if (algorithm == "counting") {
+        if constexpr (UsesCountingSort<T>::value) {
+            CountingSort<T> sorter;
+            sorter.sort(values);
+        } else {
+            std::cerr << "Counting sort is only available for char.\n";
+            return false;
+        }
     } else {
         std::cerr << "Unknown sorting algorithm.\n";
-        return;
+        return false;
     }
 
+    return true;
+}
+
+// Algorithms whose sorters take a Stats policy
+bool hasOperationCounts(const std::string& algorithm) {
+    return algorithm == "quick" || algorithm == "quick-3way" || algorithm.rfind("quick-drunk-", 0) == 0 ||
+           algorithm.rfind("insertion", 0) == 0 || algorithm.rfind("shell", 0) == 0 || algorithm.rfind("heap", 0) == 0;
+}
+
+// Sort a copy of the input with CountingStats, outside any timed region.
+// The quick sort counts are for the sequential sort even with --threads.
+template<typename T>
+bool countOperations(Vector<T> values, const std::string& algorithm, const RunOptions& options, CountingStats& stats) {
+    return hasOperationCounts(algorithm) && sortWithAlgorithm(values, algorithm, options, &stats);
+}
+
+template<typename T>
+bool sortAndSave(Vector<T>& values, const std::string& algorithm, const std::string& outputFile,
+                 const RunOptions& options, PhaseProfiler& profiler) {
+    // The counted run sorts its own copy of the input
+    Vector<T> countingInput;
+    if (options.stats) {
+        countingInput = values;
+    }
+
+    // Counters are opened before and read after the timed region
+    std::optional<PerfCounters> counters;
+    if (options.perf) {
+        counters.emplace();
+        counters->start();
+    }
+
+    Timer timer;
+    timer.start();
+    bool sorted = sortWithAlgorithm(values, algorithm, options);
     timer.stop();
+    if (counters) {
+        counters->stop();
+    }
+    profiler.add(Phase::Sort, timer.resultNs());
+
+    if (!sorted) {
+        return false;
+    }
 
     std::cout << "\nSorted list:\n";
-    list.printList();
+    values.print();
 
-    int percentCorrect = list.checkSortedList();
+    auto verify = profiler.scope(Phase::Verify);
+    int percentCorrect = values.checkSorted();
+    verify.stop();
     std::cout << "Correctness: " << percentCorrect << "%\n";
 
     if (!outputFile.empty()) {
-        list.saveToFile(outputFile);
-        std::cout << "Saved sorted data to: " << outputFile << '\n';
+        auto save = profiler.scope(Phase::Save);
+        if (options.binaryOutput) {
+            if (values.saveToBinaryFile(outputFile) == 0) {
+                std::cout << "Saved sorted data (binary) to: " << outputFile << '\n';
+            }
+        } else {
+            values.saveToFile(outputFile, options.threads);
+            std::cout << "Saved sorted data to: " << outputFile << '\n';
+        }
+    }
+
+    std::cout << "\nExecution time: " << timer.resultMs() << " ms\n";
+    if (counters) {
+        counters->print(std::cout);
     }
+    if (options.stats) {
+        CountingStats stats;
+        if (countOperations(countingInput, algorithm, options, stats)) {
+            stats.print(std::cout);
+        } else {
+            std::cout << "Operation counts are not collected for " << algorithm << ".\n";
+        }
+    }
+    return true;
+}
 
-    std::cout << "\nExecution time: " << timer.result() << " ms\n";
+// Print the run's phase breakdown and append it to --profile, if given
+void reportPhases(const PhaseProfiler& profiler, const RunOptions& options, const std::string& label) {
+    std::cout << '\n';
+    profiler.print(std::cout);
+
+    if (!options.profileFile.empty() && !profiler.appendCsv(options.profileFile, label)) {
+        std::cerr << "Could not write profile: " << options.profileFile << "\n";
+    }
 }
 
 template<typename T>
-void handleFileMode(const std::string& algorithm, const std::string& inputFile, const std::string& outputFile) {
-    List<T> list;
-    if (list.loadFromFile(inputFile) != 0) {
+const char* typeName() {
+    return BinaryFormat::typeName(BinaryFormat::typeTag<T>());
+}
+
+// Load a text or binary data file, whichever the file turns out to be
+template<typename T>
+int loadDataFile(Vector<T>& values, const std::string& inputFile, bool& binary, int threads) {
+    binary = BinaryFormat::isBinaryFile(inputFile);
+    return binary ? values.loadFromBinaryFile(inputFile) : values.loadFromFile(inputFile, threads);
+}
+
+template<typename T>
+void handleFileMode(const std::string& algorithm, const std::string& inputFile, const std::string& outputFile,
+                    const RunOptions& options) {
+    Vector<T> values;
+    bool binary = false;
+    PhaseProfiler profiler;
+
+    Timer timer;
+    timer.start();
+    if (loadDataFile(values, inputFile, binary, options.threads) != 0) {
         std::cerr << "Failed to load data from file.\n";
         return;
     }
+    timer.stop();
+    profiler.add(Phase::Load, timer.resultNs());
 
-    std::cout << "\nLoaded list:\n";
-    list.printList();
+    std::cout << "\nLoaded list (" << (binary ? "binary" : "text") << ", " << timer.resultMs() << " ms):\n";
+    values.print();
 
-    sortAndSave(list, algorithm, outputFile);
+    // Binary input gives binary output unless asked otherwise
+    RunOptions fileOptions = options;
+    fileOptions.binaryOutput = options.binaryOutput || binary;
+    if (sortAndSave(values, algorithm, outputFile, fileOptions, profiler)) {
+        reportPhases(profiler, options, std::string("file;") + algorithm + ";" + typeName<T>() + ";" + inputFile);
+    }
+}
+
+// Rewrite a data file in the other format: text -> binary, binary -> text
+template<typename T>
+void handleConvertMode(const std::string& inputFile, const std::string& outputFile) {
+    Vector<T> values;
+    bool binary = false;
+
+    Timer timer;
+    timer.start();
+    if (loadDataFile(values, inputFile, binary, 0) != 0) {
+        std::cerr << "Failed to load data from file.\n";
+        return;
+    }
+    timer.stop();
+    double loadTime = timer.resultMs();
+
+    timer.start();
+    if (binary) {
+        values.saveToFile(outputFile);
+    } else if (values.saveToBinaryFile(outputFile) != 0) {
+        return;
+    }
+    timer.stop();
+
+    std::cout << "Converted " << values.getSize() << " values from " << (binary ? "binary to text" : "text to binary")
+              << ": " << outputFile << "\n"
+              << "Load time: " << loadTime << " ms\n"
+              << "Save time: " << timer.resultMs() << " ms\n";
+}
+
+template<typename T>
+void handleExternalMode(const std::string& algorithm, const std::string& inputFile, const std::string& outputFile,
+                        const RunOptions& options) {
+    ExternalSort<T> sorter;
+    if (options.memoryLimit > 0) sorter.setMemoryLimit(options.memoryLimit);
+    if (!options.tempDirectory.empty()) sorter.setTempDirectory(options.tempDirectory);
+
+    auto sortChunk = [&](Vector<T>& chunk) { return sortWithAlgorithm(chunk, algorithm, options); };
+    if (sorter.sort(inputFile, outputFile, sortChunk) != 0) {
+        std::cerr << "External sort failed.\n";
+        return;
+    }
+
+    long long total = sorter.getElementCount();
+    int percentCorrect = total <= 1 ? 100 : static_cast<int>((100.0 * sorter.getSortedCount()) / total);
+
+    std::cout << "\nSorted " << total << " elements in " << sorter.getRunCount() << " runs, "
+              << sorter.getMergePasses() << " merge pass(es)\n";
+    std::cout << sorter.getSortedCount() << " out of " << total << " elements sorted correctly ("
+              << percentCorrect << "%).\n";
+    std::cout << "Correctness: " << percentCorrect << "%\n";
+    std::cout << "Saved sorted data to: " << outputFile << '\n';
+
+    std::cout << "\nRun generation time: " << sorter.getRunGenerationTime() << " ms\n"
+              << "Merge time: " << sorter.getMergeTime() << " ms\n"
+              << "Execution time: " << sorter.getRunGenerationTime() + sorter.getMergeTime() << " ms\n";
+}
+
+template<typename T>
+void handleMergeMode(const std::string& outputFile, const Vector<std::string>& inputFiles, const RunOptions& options) {
+    KWayMerge<T> merger;
+    if (options.bufferSize > 0) merger.setBufferSize(options.bufferSize);
+
+    if (merger.merge(inputFiles, outputFile) != 0) {
+        std::cerr << "Merge failed.\n";
+        return;
+    }
+
+    long long total = merger.getElementCount();
+    int percentCorrect = total <= 1 ? 100 : static_cast<int>((100.0 * merger.getSortedCount()) / total);
+
+    std::cout << "\nMerged " << inputFiles.getSize() << " files, " << total << " elements\n";
+    if (merger.getUnsortedInputs() > 0) {
+        std::cout << merger.getUnsortedInputs() << " input file(s) were not sorted.\n";
+    }
+    std::cout << merger.getSortedCount() << " out of " << total << " elements sorted correctly ("
+              << percentCorrect << "%).\n";
+    std::cout << "Correctness: " << percentCorrect << "%\n";
+    std::cout << "Saved sorted data to: " << outputFile << '\n';
+
+    std::cout << "\nExecution time: " << merger.getMergeTime() << " ms\n";
 }
 
+// Fill values with 'size' elements in the named arrangement, drawing random
+// values on 'threads' threads (the data is the same for any count).
+// The skewed arrangements take an optional parameter: "zipf:1.2", "sawtooth:4", ...
 template<typename T>
-void handleTestMode(const std::string& algorithm, int size, const std::string& sortType, const std::string& outputFile) {
-    List<T> list;
-
-    if (sortType == "random") {
-        list.generateList(size);
-    } else if (sortType == "ascending") {
-        list.generateListAscending(size);
-    } else if (sortType == "descending") {
-        list.generateListDescending(size);
-    } else if (sortType == "sorted33") {
-        list.generateListSorted33(size);
-    } else if (sortType == "sorted66") {
-        list.generateListSorted66(size);
+bool generateInput(Vector<T>& values, const std::string& sortType, int size, int threads) {
+    size_t colon = sortType.find(':');
+    std::string name = sortType.substr(0, colon);
+    bool hasParameter = colon != std::string::npos;
+    double parameter = 0.0;
+
+    if (hasParameter) {
+        try {
+            size_t parsed = 0;
+            parameter = std::stod(sortType.substr(colon + 1), &parsed);
+            if (parsed != sortType.size() - colon - 1) throw std::invalid_argument("parameter");
+        } catch (const std::exception&) {
+            std::cerr << "Invalid parameter in sort type: " << sortType << "\n";
+            return false;
+        }
+    }
+
+    // Integer parameters must be at least 'minimum'
+    auto count = [&](int fallback, int minimum, int& value) {
+        value = hasParameter ? static_cast<int>(parameter) : fallback;
+        if (value < minimum || (hasParameter && value != parameter)) {
+            std::cerr << "The " << name << " parameter must be an integer >= " << minimum << ".\n";
+            return false;
+        }
+        return true;
+    };
+    int amount = 0;
+
+    if (hasParameter && (name == "random" || name == "ascending" || name == "descending" || name == "sorted33" ||
+                         name == "sorted66" || name == "organ_pipe")) {
+        std::cerr << "Sort type " << name << " takes no parameter.\n";
+        return false;
+    }
+
+    if (name == "random") {
+        values.generateRandom(size, threads);
+    } else if (name == "ascending") {
+        values.generateAscending(size);
+    } else if (name == "descending") {
+        values.generateDescending(size);
+    } else if (name == "sorted33") {
+        values.generateSorted33(size, threads);
+    } else if (name == "sorted66") {
+        values.generateSorted66(size, threads);
+    } else if (name == "zipf") {
+        double exponent = hasParameter ? parameter : 1.0;
+        if (!(exponent > 0.0)) {
+            std::cerr << "The zipf exponent must be > 0.\n";
+            return false;
+        }
+        values.generateZipf(size, exponent, threads);
+    } else if (name == "few_unique") {
+        if (!count(16, 1, amount)) return false;
+        values.generateFewUnique(size, amount, threads);
+    } else if (name == "organ_pipe") {
+        values.generateOrganPipe(size);
+    } else if (name == "sawtooth") {
+        if (!count(8, 1, amount)) return false;
+        values.generateSawtooth(size, amount);
+    } else if (name == "sorted_swaps") {
+        if (!count(16, 0, amount)) return false;
+        values.generateSortedSwaps(size, amount);
+    } else if (name == "noisy") {
+        if (!count(16, 0, amount)) return false;
+        values.generateNoisy(size, amount, threads);
     } else {
-        std::cerr << "Unknown sort type. Use random, ascending, descending, sorted33 or sorted66.\n";
+        std::cerr << "Unknown sort type. Use random, ascending, descending, sorted33, sorted66, zipf[:s],\n"
+                  << "few_unique[:k], organ_pipe, sawtooth[:teeth], sorted_swaps[:k] or noisy[:distance].\n";
+        return false;
+    }
+    return true;
+}
+
+// "zipf:1.5" -> "zipf1_5", so result file names stay [a-z0-9_] for generate_csv_files.py
+std::string fileSafeName(const std::string& name) {
+    std::string safe;
+    for (char c : name) {
+        if (c == ':') continue;
+        safe += (std::isalnum(static_cast<unsigned char>(c)) || c == '_') ? c : '_';
+    }
+    return safe;
+}
+
+template<typename T>
+void handleTestMode(const std::string& algorithm, int size, const std::string& sortType, const std::string& outputFile,
+                    const RunOptions& options) {
+    Vector<T> values;
+    PhaseProfiler profiler;
+
+    auto generate = profiler.scope(Phase::Generate);
+    if (!generateInput(values, sortType, size, options.threads)) {
         return;
     }
+    generate.stop();
 
-    std::cout << "\nGenerated list (" << sortType << "):\n";
-    list.printList();
+    std::cout << "\nGenerated list (" << sortType << ", seed " << RandomGenerator::getSeed() << "):\n";
+    values.print();
 
-    sortAndSave(list, algorithm, outputFile);
+    if (sortAndSave(values, algorithm, outputFile, options, profiler)) {
+        reportPhases(profiler, options, std::string("test;") + algorithm + ";" + typeName<T>() + ";" + sortType + ";" +
+                                            std::to_string(size));
+    }
+}
+
+std::vector<std::string> splitList(const std::string& list) {
+    std::vector<std::string> items;
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t comma = list.find(',', start);
+        if (comma == std::string::npos) comma = list.size();
+        if (comma > start) items.push_back(list.substr(start, comma - start));
+        start = comma + 1;
+    }
+    return items;
+}
+
+// One grid cell: warmup runs, then 'iterations' timed sorts of freshly
+// generated input. Every run goes to results/<algorithm>-<type>-<order>-<size>.csv
+// as "size;ms;percent" (the layout generate_csv_files.py reads), and the
+// cell's statistics go to the summary.
+template<typename T>
+bool benchCell(const std::string& algorithm, const std::string& type, int size, const std::string& order,
+               const RunOptions& options, FILE* summary) {
+    Vector<T> values;
+
+    for (int i = 0; i < options.warmup; ++i) {
+        if (!generateInput(values, order, size, options.threads) || !sortWithAlgorithm(values, algorithm, options)) {
+            return false;
+        }
+    }
+
+    std::string path = options.resultsDir + "/" + algorithm + "-" + type + "-" + fileSafeName(order) + "-" +
+                       std::to_string(size) + ".csv";
+    FILE* csv = fopen(path.c_str(), "w");
+    if (csv == nullptr) {
+        std::cerr << "Could not open file for writing: " << path << "\n";
+        return false;
+    }
+
+    std::vector<double> times;
+    double percentSum = 0.0;
+
+    std::optional<PerfCounters> counters;
+    long long counterSums[static_cast<int>(Counter::Count)] = {};
+
+    bool counting = options.stats && hasOperationCounts(algorithm);
+    Vector<T> countingInput;
+    CountingStats statsSum;
+    if (options.perf) {
+        counters.emplace();
+    }
+
+    for (int i = 0; i < options.iterations; ++i) {
+        // Input generation stays outside the timed region
+        if (!generateInput(values, order, size, options.threads)) {
+            fclose(csv);
+            return false;
+        }
+
+        if (counting) {
+            countingInput = values;
+        }
+
+        if (counters) {
+            counters->start();
+        }
+        Timer timer;
+        timer.start();
+        bool sorted = sortWithAlgorithm(values, algorithm, options);
+        timer.stop();
+        if (counters) {
+            counters->stop();
+        }
+        double ms = timer.resultMs();
+        if (!sorted) {
+            fclose(csv);
+            return false;
+        }
+
+        int percent = size <= 1 ? 100 : static_cast<int>((100.0 * values.sortedPrefix()) / size);
+        fprintf(csv, "%d;%.6f;%d", size, ms, percent);
+        if (counters) {
+            fprintf(csv, ";%s", counters->csvValues().c_str());
+            for (int c = 0; c < static_cast<int>(Counter::Count); ++c) {
+                counterSums[c] += std::max(0LL, counters->getValue(static_cast<Counter>(c)));
+            }
+        }
+        if (counting) {
+            // Counted on the copy, after the timed sort
+            CountingStats stats;
+            countOperations(countingInput, algorithm, options, stats);
+            fprintf(csv, ";%s", stats.csvValues().c_str());
+
+            statsSum.comparisons += stats.comparisons;
+            statsSum.swaps += stats.swaps;
+            statsSum.moves += stats.moves;
+            statsSum.maxDepth = std::max(statsSum.maxDepth, stats.maxDepth);
+            statsSum.partitions += stats.partitions;
+            statsSum.imbalanceSum += stats.imbalanceSum;
+            statsSum.maxImbalance = std::max(statsSum.maxImbalance, stats.maxImbalance);
+        }
+        fprintf(csv, "\n");
+        times.push_back(ms);
+        percentSum += percent;
+    }
+    fclose(csv);
+
+    SampleSummary timeStats = Statistics::summarize(times);
+    double correct = percentSum / options.iterations;
+
+    // Per-run means of the counters; empty fields when not measured
+    std::string counterMeans;
+    for (int c = 0; c < static_cast<int>(Counter::Count); ++c) {
+        counterMeans += ';';
+        if (counters && counters->isAvailable(static_cast<Counter>(c))) {
+            counterMeans += std::to_string(counterSums[c] / options.iterations);
+        }
+    }
+    counterMeans += ';';
+    int cycles = static_cast<int>(Counter::Cycles), instructions = static_cast<int>(Counter::Instructions);
+    if (counters && counterSums[cycles] > 0 && counters->isAvailable(Counter::Instructions)) {
+        counterMeans += std::to_string(static_cast<double>(counterSums[instructions]) / counterSums[cycles]);
+    }
+
+    // Per-run means of the operation counts (the maxima stay maxima)
+    std::string operationMeans = ";;;;;;;";
+    if (counting) {
+        char means[200];
+        snprintf(means, sizeof(means), ";%lld;%lld;%lld;%d;%lld;%.4f;%.4f", statsSum.comparisons / options.iterations,
+                 statsSum.swaps / options.iterations, statsSum.moves / options.iterations, statsSum.maxDepth,
+                 statsSum.partitions / options.iterations, statsSum.getMeanImbalance(), statsSum.maxImbalance);
+        operationMeans = means;
+    }
+
+    fprintf(summary, "%s;%s;%s;%d;%d;%.6f;%.6f;%.6f;%.6f;%.6f;%.6f;%.2f%s%s\n", algorithm.c_str(), type.c_str(),
+            order.c_str(), size, timeStats.count, timeStats.median, timeStats.p95, timeStats.mean, timeStats.stddev,
+            timeStats.min, timeStats.max, correct, counterMeans.c_str(), operationMeans.c_str());
+    fflush(summary);
+
+    printf("%-14s %-7s %-13s %9d  median %10.3f ms  p95 %10.3f ms  stddev %8.3f ms  %6.2f%% correct\n",
+           algorithm.c_str(), type.c_str(), order.c_str(), size, timeStats.median, timeStats.p95, timeStats.stddev,
+           correct);
+    return true;
+}
+
+// Run the whole algorithm x type x size x order grid in this process
+int handleBenchMode(const RunOptions& options) {
+    std::vector<std::string> algorithms = splitList(options.algorithms.empty()
+        ? "quick,quick-3way,quick-drunk-1,quick-drunk-2,quick-drunk-3,quick-drunk-4,quick-drunk-5,intro,insertion,shell,heap,radix"
+        : options.algorithms);
+    std::vector<std::string> types = splitList(options.types.empty() ? "int,float,double,char" : options.types);
+    std::vector<std::string> sizeList = splitList(options.sizes.empty() ? "10000,20000,40000,80000,160000" : options.sizes);
+    std::vector<std::string> orders = splitList(options.orders.empty()
+        ? "random,ascending,descending,sorted33,sorted66,zipf,few_unique,organ_pipe,sawtooth,sorted_swaps,noisy"
+        : options.orders);
+
+    std::vector<int> sizes;
+    for (const std::string& item : sizeList) {
+        try {
+            sizes.push_back(std::stoi(item));
+        } catch (const std::exception&) {
+            std::cerr << "Invalid size: " << item << "\n";
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(options.resultsDir, error);
+    std::string summaryPath = options.resultsDir + "/summary.csv";
+    FILE* summary = fopen(summaryPath.c_str(), "w");
+    if (summary == nullptr) {
+        std::cerr << "Could not open file for writing: " << summaryPath << "\n";
+        return 1;
+    }
+    fprintf(summary, "algorithm;type;order;size;iterations;median_ms;p95_ms;mean_ms;stddev_ms;min_ms;max_ms;correct_percent;%s;%s\n",
+            PerfCounters::csvHeader().c_str(), CountingStats::csvHeader().c_str());
+
+    if (options.perf) {
+        PerfCounters probe;
+        if (!probe.isAvailable()) {
+            probe.print(std::cerr);
+        }
+    }
+
+    std::cout << "Benchmark grid: " << algorithms.size() << " algorithms x " << types.size() << " types x "
+              << sizes.size() << " sizes x " << orders.size() << " orders, " << options.warmup << " warmup + "
+              << options.iterations << " timed runs per cell, seed " << RandomGenerator::getSeed() << "\n";
+
+    int failed = 0;
+    for (const std::string& algorithm : algorithms) {
+        for (const std::string& type : types) {
+            for (int size : sizes) {
+                for (const std::string& order : orders) {
+                    bool ok;
+                    if (type == "int") ok = benchCell<int>(algorithm, type, size, order, options, summary);
+                    else if (type == "float") ok = benchCell<float>(algorithm, type, size, order, options, summary);
+                    else if (type == "double") ok = benchCell<double>(algorithm, type, size, order, options, summary);
+                    else if (type == "char") ok = benchCell<char>(algorithm, type, size, order, options, summary);
+                    else {
+                        std::cerr << "Unsupported data type: " << type << "\n";
+                        ok = false;
+                    }
+
+                    if (!ok) {
+                        std::cerr << "Skipped " << algorithm << " " << type << " " << order << " " << size << "\n";
+                        failed++;
+                    }
+                }
+            }
+        }
+    }
+
+    fclose(summary);
+    std::cout << "Results saved in: " << options.resultsDir << " (summary: " << summaryPath << ")\n";
+    return failed == 0 ? 0 : 1;
+}
+
+// Monte Carlo over fault injection: 'trials' QuickSortDrunk sorts of one
+// generated input per drunk level, spread over a thread pool. Trial t sorts
+// with a seed drawn up front from the process seed, so the distribution is
+// the same for any thread count. Reports the spread of the sorted prefix.
+template<typename T>
+int handleMonteCarloMode(int size, const std::string& sortType, const RunOptions& options) {
+    std::vector<std::string> algorithms = splitList(options.algorithms.empty()
+        ? "quick-drunk-1,quick-drunk-2,quick-drunk-3,quick-drunk-4,quick-drunk-5"
+        : options.algorithms);
+    std::vector<int> levels;
+    for (const std::string& algorithm : algorithms) {
+        int level = 0;
+        if (algorithm.rfind("quick-drunk-", 0) == 0) {
+            try {
+                level = std::stoi(algorithm.substr(12));
+            } catch (const std::exception&) {
+            }
+        }
+        if (level < 1 || level > 5) {
+            std::cerr << "--montecarlo runs quick-drunk-1..5, not " << algorithm << "\n";
+            return 1;
+        }
+        levels.push_back(level);
+    }
+
+    Vector<T> input;
+    if (!generateInput(input, sortType, size, options.threads)) {
+        return 1;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(options.resultsDir, error);
+    std::string summaryPath = options.resultsDir + "/montecarlo.csv";
+    FILE* summary = fopen(summaryPath.c_str(), "w");
+    if (summary == nullptr) {
+        std::cerr << "Could not open file for writing: " << summaryPath << "\n";
+        return 1;
+    }
+    fprintf(summary, "algorithm;type;order;size;trials;mean_percent;stddev_percent;min_percent;p5_percent;"
+                     "median_percent;p95_percent;max_percent;fully_sorted_percent\n");
+
+    char pivot = options.pivot ? options.pivot : 'm';
+    ThreadPool pool(options.threads > 0 ? options.threads : ThreadPool::hardwareThreads());
+    std::cout << "Monte Carlo: " << options.trials << " trials per level, " << typeName<T>() << " " << sortType << " "
+              << size << ", " << pool.getThreadCount() << " threads, seed " << RandomGenerator::getSeed() << "\n";
+
+    for (size_t a = 0; a < levels.size(); ++a) {
+        RandomGenerator seeds = RandomGenerator::forDataset();
+        std::vector<uint64_t> trialSeeds(options.trials);
+        for (uint64_t& seed : trialSeeds) {
+            seed = seeds.next();
+        }
+
+        std::vector<double> percents(options.trials);
+        Timer timer;
+        timer.start();
+        for (int t = 0; t < options.trials; ++t) {
+            pool.submit([&, t, a] {
+                Vector<T> values(input);
+                QuickSortDrunk<T> sorter(levels[a], trialSeeds[t]);
+                sorter.sort(values, pivot);
+                percents[t] = size <= 1 ? 100.0 : (100.0 * values.sortedPrefix()) / size;
+            });
+        }
+        pool.waitIdle();
+        timer.stop();
+
+        int fullySorted = static_cast<int>(std::count(percents.begin(), percents.end(), 100.0));
+        std::vector<double> sorted(percents);
+        std::sort(sorted.begin(), sorted.end());
+        SampleSummary stats = Statistics::summarize(percents);
+        double p5 = Statistics::percentile(sorted, 5.0);
+        double fullyPercent = (100.0 * fullySorted) / options.trials;
+
+        fprintf(summary, "%s;%s;%s;%d;%d;%.4f;%.4f;%.4f;%.4f;%.4f;%.4f;%.4f;%.2f\n", algorithms[a].c_str(),
+                typeName<T>(), sortType.c_str(), size, stats.count, stats.mean, stats.stddev, stats.min, p5,
+                stats.median, stats.p95, stats.max, fullyPercent);
+        fflush(summary);
+
+        printf("%-14s sorted prefix: mean %7.3f%%  stddev %7.3f  min %7.3f%%  p5 %7.3f%%  median %7.3f%%  "
+               "max %7.3f%%  fully sorted %6.2f%%  (%.1f ms, %.0f trials/s)\n",
+               algorithms[a].c_str(), stats.mean, stats.stddev, stats.min, p5, stats.median, stats.max, fullyPercent,
+               timer.resultMs(), options.trials / (timer.resultMs() / 1000.0));
+    }
+
+    fclose(summary);
+    std::cout << "Results saved in: " << summaryPath << "\n";
+    return 0;
 }
 
 void printHelp() {
     std::cout << "\nUsage:\n"
-              << "./main --file <algorithm> <type> <inputFile> [outputFile]\n"
-              << "./main --test <algorithm> <type> <size> <sort> <outputFile>\n"
+              << "./main --file <algorithm> <type> <inputFile> [outputFile] [options]\n"
+              << "./main --test <algorithm> <type> <size> <sort> <outputFile> [options]\n"
+              << "./main --external <algorithm> <type> <inputFile> <outputFile> [options]\n"
+              << "./main --merge <type> <outputFile> <inputFile1> <inputFile2> ... [options]\n"
+              << "./main --convert <type> <inputFile> <outputFile>\n"
+              << "./main --bench [options]\n"
+              << "./main --montecarlo <type> <size> <sort> [options]\n"
               << "./main --help\n\n"
               << "Arguments:\n"
-              << "  <algorithm>   quick | quick-drunk-1..5 | insertion | shell | heap\n"
+              << "  <algorithm>   quick | quick-3way | quick-drunk-1..5 | intro | insertion | insertion-sentinel |\n"
+              << "                insertion-binary | shell | shell-papernov | shell-tokuda | shell-ciura |\n"
+              << "                shell-sedgewick | shell-pratt | heap | heap-iter | heap-bottomup | heap-4ary |\n"
+              << "                heap-8ary | radix | counting\n"
               << "  <type>        int | float | double | char\n"
-              << "  <sort>        random | ascending | descending | sorted33 | sorted66\n\n"
+              << "  <sort>        random | ascending | descending | sorted33 | sorted66 |\n"
+              << "                zipf[:s] (exponent, default 1) | few_unique[:k] (distinct values, 16) |\n"
+              << "                organ_pipe | sawtooth[:teeth] (8) | sorted_swaps[:k] (random swaps, 16) |\n"
+              << "                noisy[:d] (keys moved by up to +-d, 16)\n\n"
+              << "Options:\n"
+              << "  --threads <N> run 'quick' on a work-stealing pool of N threads; text input/output and random data use N threads\n"
+              << "  --kernels     finish small quick/quick-3way/shell ranges with SIMD sorting networks\n"
+              << "  --pivot <P>   pivot strategy for quick/quick-3way/intro: l | m | r | x | 3 (median of 3) | n (ninther)\n"
+              << "  --memory <MiB> --external run size (default 256)\n"
+              << "  --tmp-dir <D> --external spill directory (default $TMPDIR or /tmp)\n"
+              << "  --buffer <KiB> --merge read/write buffer per file (default 1024)\n"
+              << "  --binary      save the sorted output in the binary format\n"
+              << "  --seed <S>    seed the random data (and random pivots) to reproduce a run; --test and --bench print\n"
+              << "                the seed they used\n"
+              << "  --tsc         time with the calibrated time-stamp counter instead of steady_clock\n"
+              << "  --profile <F> append the run's per-phase nanosecond breakdown to CSV file F\n"
+              << "  --perf        read cycles, instructions, L1d/LLC/dTLB and branch misses around the sort (Linux)\n"
+              << "  --stats       count comparisons, swaps, moves, depth and partition imbalance in an extra untimed\n"
+              << "                sort of the same input (quick, quick-3way, quick-drunk, insertion*, shell*, heap*)\n"
+              << "  --no-prefetch don't prefetch grandchildren in heap-iter/-bottomup/-4ary/-8ary\n"
+              << "  --algorithms <a,b,..> --types <t,..> --sizes <n,..> --orders <o,..>\n"
+              << "                --bench grid (default: the sort_tester.sh grid)\n"
+              << "  --iterations <N> --warmup <W>  --bench timed and untimed runs per cell (default 100 and 3)\n"
+              << "  --results <D> --bench/--montecarlo output directory (default results)\n"
+              << "  --trials <N>  --montecarlo sorts per drunk level (default 1000; levels from --algorithms,\n"
+              << "                default quick-drunk-1..5; --threads sets the pool size, default all cores)\n\n"
               << "Examples:\n"
               << "  ./main --file quick int ./input.txt ./sorted.txt\n"
               << "  ./main --test heap double 100 random ./output.txt\n"
+              << "  ./main --test quick-3way int 1000000 zipf:1.2 ./output.txt\n"
+              << "  ./main --test quick int 10000000 random ./output.txt --threads 8\n"
+              << "  ./main --external radix int ./huge.txt ./sorted.txt --memory 512\n"
+              << "  ./main --merge int ./all.txt ./shard1.txt ./shard2.txt ./shard3.txt\n"
+              << "  ./main --convert int ./input.txt ./input.bin\n"
+              << "  ./main --bench --algorithms quick,heap --types int --sizes 100000 --iterations 20\n"
+              << "  ./main --montecarlo int 100000 random --trials 5000 --seed 7\n"
               << "Note:\n"
-              << "  'quick-drunk-N' uses QuickSort with N% chance (1-5) of making a wrong comparison.\n";
+              << "  'quick-drunk-N' uses QuickSort that skips each swap with probability N/100000 (N = 1-5).\n"
+              << "  '--montecarlo' runs many seeded quick-drunk sorts of one input in parallel and reports how much\n"
+              << "                of the output ends up sorted (results/montecarlo.csv).\n"
+              << "  'quick-3way' partitions into <, == and > pivot (fast on many duplicates).\n"
+              << "  'insertion-sentinel' moves the minimum to the front to drop the bounds check;\n"
+              << "  'insertion-binary' binary searches the slot and shifts with one memmove.\n"
+              << "  'shell' uses Sedgewick's gaps (Ciura's for char); 'shell-<name>' picks a sequence (Ciura's is extended by x2.25).\n"
+              << "  'heap-iter' sifts with a loop and a hole; 'heap-bottomup' is Floyd's bottom-up sift-down;\n"
+              << "  'heap-4ary'/'heap-8ary' are bottom-up d-ary heaps whose children share a cache line.\n"
+              << "  'radix' is a byte-wise LSD radix sort (NaNs are placed last).\n"
+              << "  'counting' is a counting sort for char; intro and radix use it automatically for char.\n"
+              << "  'intro' is a hybrid QuickSort with insertion sort for small ranges and a heapsort fallback.\n"
+              << "  '--external' sorts memory-sized runs with <algorithm>, spills them to temp files and k-way merges them.\n"
+              << "  '--merge' combines already-sorted files in one streaming loser-tree pass.\n"
+              << "  '--file' detects binary input (see '--convert') and then also writes binary output.\n"
+              << "  '--bench' times only the sort; results/<algorithm>-<type>-<order>-<size>.csv get one\n"
+              << "  'size;ms;percent' line per run and results/summary.csv the median/p95/stddev per cell.\n"
+              << "  With '--perf' each run line also gets the counters and summary.csv their per-run means;\n"
+              << "  '--stats' does the same for the operation counts.\n";
 }
 
 int main(int argc, char* argv[]) {
@@ -140,12 +1020,132 @@ int main(int argc, char* argv[]) {
         std::string algorithm = toLower(argv[2]);
         std::string type = toLower(argv[3]);
         std::string inputFile = argv[4];
-        std::string outputFile = (argc >= 6) ? argv[5] : "";
+        bool hasOutput = argc >= 6 && !isOption(argv[5]);
+        std::string outputFile = hasOutput ? argv[5] : "";
+
+        RunOptions options;
+        if (!parseOptions(argc, argv, hasOutput ? 6 : 5, options)) {
+            return 1;
+        }
+
+        if (type == "int") handleFileMode<int>(algorithm, inputFile, outputFile, options);
+        else if (type == "float") handleFileMode<float>(algorithm, inputFile, outputFile, options);
+        else if (type == "double") handleFileMode<double>(algorithm, inputFile, outputFile, options);
+        else if (type == "char") handleFileMode<char>(algorithm, inputFile, outputFile, options);
+        else {
+            std::cerr << "Unsupported data type.\n";
+            return 1;
+        }
+
+    } else if (run_type == "--external") {
+        if (argc < 6) {
+            std::cerr << "Usage: ./main --external <algorithm> <type> <inputFile> <outputFile> [options]\n";
+            return 1;
+        }
+
+        std::string algorithm = toLower(argv[2]);
+        std::string type = toLower(argv[3]);
+        std::string inputFile = argv[4];
+        std::string outputFile = argv[5];
+
+        RunOptions options;
+        if (!parseOptions(argc, argv, 6, options)) {
+            return 1;
+        }
+
+        if (type == "int") handleExternalMode<int>(algorithm, inputFile, outputFile, options);
+        else if (type == "float") handleExternalMode<float>(algorithm, inputFile, outputFile, options);
+        else if (type == "double") handleExternalMode<double>(algorithm, inputFile, outputFile, options);
+        else if (type == "char") handleExternalMode<char>(algorithm, inputFile, outputFile, options);
+        else {
+            std::cerr << "Unsupported data type.\n";
+            return 1;
+        }
+
+    } else if (run_type == "--bench") {
+        RunOptions options;
+        if (!parseOptions(argc, argv, 2, options)) {
+            return 1;
+        }
+        return handleBenchMode(options);
+
+    } else if (run_type == "--montecarlo") {
+        if (argc < 5) {
+            std::cerr << "Usage: ./main --montecarlo <type> <size> <sort> [options]\n";
+            return 1;
+        }
+
+        std::string type = toLower(argv[2]);
+        int size;
+        try {
+            size = std::stoi(argv[3]);
+        } catch (const std::exception&) {
+            std::cerr << "Invalid size: " << argv[3] << "\n";
+            return 1;
+        }
+        std::string sortType = toLower(argv[4]);
+
+        RunOptions options;
+        if (!parseOptions(argc, argv, 5, options)) {
+            return 1;
+        }
+
+        if (type == "int") return handleMonteCarloMode<int>(size, sortType, options);
+        else if (type == "float") return handleMonteCarloMode<float>(size, sortType, options);
+        else if (type == "double") return handleMonteCarloMode<double>(size, sortType, options);
+        else if (type == "char") return handleMonteCarloMode<char>(size, sortType, options);
+        else {
+            std::cerr << "Unsupported data type.\n";
+            return 1;
+        }
+
+    } else if (run_type == "--convert") {
+        if (argc != 5) {
+            std::cerr << "Usage: ./main --convert <type> <inputFile> <outputFile>\n";
+            return 1;
+        }
+
+        std::string type = toLower(argv[2]);
+        std::string inputFile = argv[3];
+        std::string outputFile = argv[4];
+
+        if (type == "int") handleConvertMode<int>(inputFile, outputFile);
+        else if (type == "float") handleConvertMode<float>(inputFile, outputFile);
+        else if (type == "double") handleConvertMode<double>(inputFile, outputFile);
+        else if (type == "char") handleConvertMode<char>(inputFile, outputFile);
+        else {
+            std::cerr << "Unsupported data type.\n";
+            return 1;
+        }
 
-        if (type == "int") handleFileMode<int>(algorithm, inputFile, outputFile);
-        else if (type == "float") handleFileMode<float>(algorithm, inputFile, outputFile);
-        else if (type == "double") handleFileMode<double>(algorithm, inputFile, outputFile);
-        else if (type == "char") handleFileMode<char>(algorithm, inputFile, outputFile);
+    } else if (run_type == "--merge") {
+        if (argc < 5) {
+            std::cerr << "Usage: ./main --merge <type> <outputFile> <inputFile1> <inputFile2> ... [options]\n";
+            return 1;
+        }
+
+        std::string type = toLower(argv[2]);
+        std::string outputFile = argv[3];
+
+        Vector<std::string> inputFiles;
+        int next = 4;
+        while (next < argc && !isOption(argv[next])) {
+            inputFiles.pushBack(argv[next++]);
+        }
+        if (inputFiles.empty()) {
+            std::cerr << "No input files to merge.\n";
+            return 1;
+        }
+
+        RunOptions options;
+        if (!parseOptions(argc, argv, next, options)) {
+            return 1;
+        }
+
+        if (type == "int") handleMergeMode<int>(outputFile, inputFiles, options);
+        else if (type == "float") handleMergeMode<float>(outputFile, inputFiles, options);
+        else if (type == "double") handleMergeMode<double>(outputFile, inputFiles, options);
+        else if (type == "char") handleMergeMode<char>(outputFile, inputFiles, options);
         else {
             std::cerr << "Unsupported data type.\n";
             return 1;
@@ -172,10 +1172,15 @@ int main(int argc, char* argv[]) {
         std::string sortType = toLower(argv[5]);
         std::string outputFile = argv[6];
 
-        if (type == "int") handleTestMode<int>(algorithm, size, sortType, outputFile);
-        else if (type == "float") handleTestMode<float>(algorithm, size, sortType, outputFile);
-        else if (type == "double") handleTestMode<double>(algorithm, size, sortType, outputFile);
-        else if (type == "char") handleTestMode<char>(algorithm, size, sortType, outputFile);
+        RunOptions options;
+        if (!parseOptions(argc, argv, 7, options)) {
+            return 1;
+        }
+
+        if (type == "int") handleTestMode<int>(algorithm, size, sortType, outputFile, options);
+        else if (type == "float") handleTestMode<float>(algorithm, size, sortType, outputFile, options);
+        else if (type == "double") handleTestMode<double>(algorithm, size, sortType, outputFile, options);
+        else if (type == "char") handleTestMode<char>(algorithm, size, sortType, outputFile, options);
         else {
             std::cerr << "Unsupported data type.\n";
             return 1;
@@ -17,7 +17,7 @@ print_usage() {
     echo "Run specific sorting algorithm tests."
     echo
     echo "Options:"
-    echo "  -a, --algorithm ALGO    Sorting algorithm (quick, quick-drunk-1..5, insertion, shell, heap)"
+    echo "  -a, --algorithm ALGO    Sorting algorithm (quick, quick-3way, quick-drunk-1..5, intro, insertion, shell, heap, radix, counting)"
     echo "  -t, --type TYPE         Data type (int, float, double, char)"
     echo "  -s, --size SIZE         Input size (e.g., 10000, 20000, etc.)"
     echo "  -r, --sort SORT         Initial arrangement (random, ascending, descending, sorted33, sorted66)"
@@ -69,7 +69,7 @@ while [[ $# -gt 0 ]]; do
 done
 
 # Validate algorithm
-valid_algorithms=("quick" "quick-drunk-1" "quick-drunk-2" "quick-drunk-3" "quick-drunk-4" "quick-drunk-5" "insertion" "shell" "heap")
+valid_algorithms=("quick" "quick-3way" "quick-drunk-1" "quick-drunk-2" "quick-drunk-3" "quick-drunk-4" "quick-drunk-5" "intro" "insertion" "shell" "heap" "radix" "counting")
 if [[ ! " ${valid_algorithms[@]} " =~ " ${algorithm} " ]]; then
     echo "Error: Invalid algorithm '$algorithm'"
     echo "Valid algorithms are: ${valid_algorithms[*]}"